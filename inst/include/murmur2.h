@@ -1,6 +1,9 @@
 #ifndef _MURMUR2_
 #define _MURMUR2_
 
+#include <cstdint>
+#include <cstring>
+
 // Murmur2 32bit implementation, from https://github.com/aappleby/smhasher/blob/master/src/MurmurHash2.cpp
 
 inline uint32_t MurmurHash2(const void * key, int len, uint32_t seed) noexcept {
@@ -49,4 +52,46 @@ inline uint32_t MurmurHash2(const void * key, int len, uint32_t seed) noexcept {
     return h;
 }
 
+// Murmur2 64bit implementation for 64-bit platforms (MurmurHash64A), from the same file. Blocks are read with memcpy,
+// as keys (e.g. wchar_t strings on Windows) aren't always 8 bytes aligned.
+inline uint64_t MurmurHash64A(const void * key, int len, uint64_t seed) noexcept {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+
+    uint64_t h = seed ^ (len * m);
+
+    const unsigned char * data = (const unsigned char *)key;
+    const unsigned char * end = data + (len / 8) * 8;
+
+    while(data != end) {
+        uint64_t k;
+        std::memcpy(&k, data, sizeof(k));
+        data += 8;
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    switch(len & 7) {
+    case 7: h ^= uint64_t(data[6]) << 48;
+    case 6: h ^= uint64_t(data[5]) << 40;
+    case 5: h ^= uint64_t(data[4]) << 32;
+    case 4: h ^= uint64_t(data[3]) << 24;
+    case 3: h ^= uint64_t(data[2]) << 16;
+    case 2: h ^= uint64_t(data[1]) << 8;
+    case 1: h ^= uint64_t(data[0]);
+        h *= m;
+    };
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return h;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef _MURMUR3_
+#define _MURMUR3_
+
+#include <cstdint>
+
+// Murmur3 32bit implementation (MurmurHash3_x86_32), from https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+// Blocks are read as little endian, so hashes are the same on every platform txtlib runs on.
+
+// Marks the tail's intentional switch fall-throughs for -Wimplicit-fallthrough.
+#if defined(__clang__)
+#define MURMUR3_FALLTHROUGH [[clang::fallthrough]]
+#elif defined(__GNUC__) && __GNUC__ >= 7
+#define MURMUR3_FALLTHROUGH __attribute__((fallthrough))
+#else
+#define MURMUR3_FALLTHROUGH
+#endif
+
+inline uint32_t murmur3_rotl32(uint32_t x, int8_t r) noexcept {
+    return (x << r) | (x >> (32 - r));
+}
+
+inline uint32_t MurmurHash3_x86_32(const void * key, int len, uint32_t seed) noexcept {
+    const unsigned char * data = (const unsigned char *)key;
+    const int nblocks = len / 4;
+
+    uint32_t h1 = seed;
+
+    const uint32_t c1 = 0xcc9e2d51;
+    const uint32_t c2 = 0x1b873593;
+
+    // Body
+    for(int i = 0; i < nblocks; i++) {
+        const unsigned char * block = data + i * 4;
+        uint32_t k1 = (uint32_t)block[0] | ((uint32_t)block[1] << 8) | ((uint32_t)block[2] << 16) | ((uint32_t)block[3] << 24);
+
+        k1 *= c1;
+        k1 = murmur3_rotl32(k1, 15);
+        k1 *= c2;
+
+        h1 ^= k1;
+        h1 = murmur3_rotl32(h1, 13);
+        h1 = h1 * 5 + 0xe6546b64;
+    }
+
+    // Tail
+    const unsigned char * tail = data + nblocks * 4;
+
+    uint32_t k1 = 0;
+
+    switch(len & 3) {
+    case 3: k1 ^= tail[2] << 16;
+        MURMUR3_FALLTHROUGH;
+    case 2: k1 ^= tail[1] << 8;
+        MURMUR3_FALLTHROUGH;
+    case 1: k1 ^= tail[0];
+        k1 *= c1;
+        k1 = murmur3_rotl32(k1, 15);
+        k1 *= c2;
+        h1 ^= k1;
+    };
+
+    // Finalization
+    h1 ^= len;
+
+    h1 ^= h1 >> 16;
+    h1 *= 0x85ebca6b;
+    h1 ^= h1 >> 13;
+    h1 *= 0xc2b2ae35;
+    h1 ^= h1 >> 16;
+
+    return h1;
+}
+
+#endif
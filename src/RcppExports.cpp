@@ -6,6 +6,54 @@
 
 using namespace Rcpp;
 
+// benchmark_utf8_decoding
+Rcpp::List benchmark_utf8_decoding(std::vector< std::string > texts, int iterations);
+RcppExport SEXP _txtlib_benchmark_utf8_decoding(SEXP textsSEXP, SEXP iterationsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector< std::string > >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    rcpp_result_gen = Rcpp::wrap(benchmark_utf8_decoding(texts, iterations));
+    return rcpp_result_gen;
+END_RCPP
+}
+// benchmark_word_breaks
+Rcpp::List benchmark_word_breaks(std::vector< std::string > texts, int iterations);
+RcppExport SEXP _txtlib_benchmark_word_breaks(SEXP textsSEXP, SEXP iterationsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector< std::string > >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    rcpp_result_gen = Rcpp::wrap(benchmark_word_breaks(texts, iterations));
+    return rcpp_result_gen;
+END_RCPP
+}
+// benchmark_general_categories
+Rcpp::List benchmark_general_categories(std::vector< std::string > texts, int iterations);
+RcppExport SEXP _txtlib_benchmark_general_categories(SEXP textsSEXP, SEXP iterationsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector< std::string > >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    rcpp_result_gen = Rcpp::wrap(benchmark_general_categories(texts, iterations));
+    return rcpp_result_gen;
+END_RCPP
+}
+// benchmark_term_hashing
+Rcpp::List benchmark_term_hashing(std::vector< std::string > terms, int iterations);
+RcppExport SEXP _txtlib_benchmark_term_hashing(SEXP termsSEXP, SEXP iterationsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector< std::string > >::type terms(termsSEXP);
+    Rcpp::traits::input_parameter< int >::type iterations(iterationsSEXP);
+    rcpp_result_gen = Rcpp::wrap(benchmark_term_hashing(terms, iterations));
+    return rcpp_result_gen;
+END_RCPP
+}
 // icu_info
 Rcpp::List icu_info();
 RcppExport SEXP _txtlib_icu_info() {
@@ -27,8 +75,8 @@ BEGIN_RCPP
 END_RCPP
 }
 // create_uax29_vectorizer_pointer
-SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary, Rcpp::StringVector ignored_terms, std::string casing_transformation, const Rcpp::StringVector& case_sensitive_aliases, const Rcpp::StringVector& case_insensitive_aliases, size_t ngrams_size, size_t min_term_length, std::string stemming_language, std::vector< std::string > word_token_categories, std::vector< std::string > non_word_token_categories, std::string locale);
-RcppExport SEXP _txtlib_create_uax29_vectorizer_pointer(SEXP vocabularySEXP, SEXP ignored_termsSEXP, SEXP casing_transformationSEXP, SEXP case_sensitive_aliasesSEXP, SEXP case_insensitive_aliasesSEXP, SEXP ngrams_sizeSEXP, SEXP min_term_lengthSEXP, SEXP stemming_languageSEXP, SEXP word_token_categoriesSEXP, SEXP non_word_token_categoriesSEXP, SEXP localeSEXP) {
+SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary, Rcpp::StringVector ignored_terms, std::string casing_transformation, const Rcpp::StringVector& case_sensitive_aliases, const Rcpp::StringVector& case_insensitive_aliases, size_t ngrams_size, size_t min_term_length, std::string stemming_language, std::vector< std::string > word_token_categories, std::vector< std::string > non_word_token_categories, std::vector< std::string > word_token_types, std::string locale, size_t n_features, uint32_t hash_seed, bool alternate_sign);
+RcppExport SEXP _txtlib_create_uax29_vectorizer_pointer(SEXP vocabularySEXP, SEXP ignored_termsSEXP, SEXP casing_transformationSEXP, SEXP case_sensitive_aliasesSEXP, SEXP case_insensitive_aliasesSEXP, SEXP ngrams_sizeSEXP, SEXP min_term_lengthSEXP, SEXP stemming_languageSEXP, SEXP word_token_categoriesSEXP, SEXP non_word_token_categoriesSEXP, SEXP word_token_typesSEXP, SEXP localeSEXP, SEXP n_featuresSEXP, SEXP hash_seedSEXP, SEXP alternate_signSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -42,78 +90,173 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< std::string >::type stemming_language(stemming_languageSEXP);
     Rcpp::traits::input_parameter< std::vector< std::string > >::type word_token_categories(word_token_categoriesSEXP);
     Rcpp::traits::input_parameter< std::vector< std::string > >::type non_word_token_categories(non_word_token_categoriesSEXP);
+    Rcpp::traits::input_parameter< std::vector< std::string > >::type word_token_types(word_token_typesSEXP);
     Rcpp::traits::input_parameter< std::string >::type locale(localeSEXP);
-    rcpp_result_gen = Rcpp::wrap(create_uax29_vectorizer_pointer(vocabulary, ignored_terms, casing_transformation, case_sensitive_aliases, case_insensitive_aliases, ngrams_size, min_term_length, stemming_language, word_token_categories, non_word_token_categories, locale));
+    Rcpp::traits::input_parameter< size_t >::type n_features(n_featuresSEXP);
+    Rcpp::traits::input_parameter< uint32_t >::type hash_seed(hash_seedSEXP);
+    Rcpp::traits::input_parameter< bool >::type alternate_sign(alternate_signSEXP);
+    rcpp_result_gen = Rcpp::wrap(create_uax29_vectorizer_pointer(vocabulary, ignored_terms, casing_transformation, case_sensitive_aliases, case_insensitive_aliases, ngrams_size, min_term_length, stemming_language, word_token_categories, non_word_token_categories, word_token_types, locale, n_features, hash_seed, alternate_sign));
+    return rcpp_result_gen;
+END_RCPP
+}
+// term_collisions_impl
+IntegerVector term_collisions_impl(SEXP vectorizer_handle);
+RcppExport SEXP _txtlib_term_collisions_impl(SEXP vectorizer_handleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
+    rcpp_result_gen = Rcpp::wrap(term_collisions_impl(vectorizer_handle));
     return rcpp_result_gen;
 END_RCPP
 }
 // tokenize_impl
-std::vector< std::vector < std::string > > tokenize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel);
-RcppExport SEXP _txtlib_tokenize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP) {
+List tokenize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, bool lazy);
+RcppExport SEXP _txtlib_tokenize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP lazySEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
-    Rcpp::traits::input_parameter< std::vector<std::string> >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
     Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
-    rcpp_result_gen = Rcpp::wrap(tokenize_impl(vectorizer_handle, texts, parallel));
+    Rcpp::traits::input_parameter< bool >::type lazy(lazySEXP);
+    rcpp_result_gen = Rcpp::wrap(tokenize_impl(vectorizer_handle, texts, parallel, lazy));
     return rcpp_result_gen;
 END_RCPP
 }
 // sentence_tokenize_impl
-std::vector< std::vector < std::vector < std::string > > > sentence_tokenize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel);
-RcppExport SEXP _txtlib_sentence_tokenize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP) {
+List sentence_tokenize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, bool lazy);
+RcppExport SEXP _txtlib_sentence_tokenize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP lazySEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
-    Rcpp::traits::input_parameter< std::vector<std::string> >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
     Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
-    rcpp_result_gen = Rcpp::wrap(sentence_tokenize_impl(vectorizer_handle, texts, parallel));
+    Rcpp::traits::input_parameter< bool >::type lazy(lazySEXP);
+    rcpp_result_gen = Rcpp::wrap(sentence_tokenize_impl(vectorizer_handle, texts, parallel, lazy));
+    return rcpp_result_gen;
+END_RCPP
+}
+// tokenize_spans_impl
+List tokenize_spans_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, bool code_points, bool types);
+RcppExport SEXP _txtlib_tokenize_spans_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP code_pointsSEXP, SEXP typesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
+    Rcpp::traits::input_parameter< bool >::type code_points(code_pointsSEXP);
+    Rcpp::traits::input_parameter< bool >::type types(typesSEXP);
+    rcpp_result_gen = Rcpp::wrap(tokenize_spans_impl(vectorizer_handle, texts, parallel, code_points, types));
     return rcpp_result_gen;
 END_RCPP
 }
 // vectorize_impl
-S4 vectorize_impl(SEXP vectorizer_handle, std::vector< std::string > texts, bool parallel, bool with_dimnames);
-RcppExport SEXP _txtlib_vectorize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP with_dimnamesSEXP) {
+S4 vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, bool with_dimnames, std::string format);
+RcppExport SEXP _txtlib_vectorize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP with_dimnamesSEXP, SEXP formatSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
-    Rcpp::traits::input_parameter< std::vector< std::string > >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
     Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
     Rcpp::traits::input_parameter< bool >::type with_dimnames(with_dimnamesSEXP);
-    rcpp_result_gen = Rcpp::wrap(vectorize_impl(vectorizer_handle, texts, parallel, with_dimnames));
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    rcpp_result_gen = Rcpp::wrap(vectorize_impl(vectorizer_handle, texts, parallel, with_dimnames, format));
     return rcpp_result_gen;
 END_RCPP
 }
 // sentence_vectorize_impl
-List sentence_vectorize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel, bool with_dimnames);
-RcppExport SEXP _txtlib_sentence_vectorize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP with_dimnamesSEXP) {
+List sentence_vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, bool with_dimnames, std::string format, bool combined);
+RcppExport SEXP _txtlib_sentence_vectorize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP with_dimnamesSEXP, SEXP formatSEXP, SEXP combinedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
-    Rcpp::traits::input_parameter< std::vector<std::string> >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
     Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
     Rcpp::traits::input_parameter< bool >::type with_dimnames(with_dimnamesSEXP);
-    rcpp_result_gen = Rcpp::wrap(sentence_vectorize_impl(vectorizer_handle, texts, parallel, with_dimnames));
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    Rcpp::traits::input_parameter< bool >::type combined(combinedSEXP);
+    rcpp_result_gen = Rcpp::wrap(sentence_vectorize_impl(vectorizer_handle, texts, parallel, with_dimnames, format, combined));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hash_vectorize_impl
+S4 hash_vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel, std::string format);
+RcppExport SEXP _txtlib_hash_vectorize_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP parallelSEXP, SEXP formatSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    rcpp_result_gen = Rcpp::wrap(hash_vectorize_impl(vectorizer_handle, texts, parallel, format));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// fit_vocabulary_impl
+StringVector fit_vocabulary_impl(SEXP vectorizer_handle, StringVector texts, double min_df, double max_df, size_t max_features, bool parallel);
+RcppExport SEXP _txtlib_fit_vocabulary_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP min_dfSEXP, SEXP max_dfSEXP, SEXP max_featuresSEXP, SEXP parallelSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< double >::type min_df(min_dfSEXP);
+    Rcpp::traits::input_parameter< double >::type max_df(max_dfSEXP);
+    Rcpp::traits::input_parameter< size_t >::type max_features(max_featuresSEXP);
+    Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
+    rcpp_result_gen = Rcpp::wrap(fit_vocabulary_impl(vectorizer_handle, texts, min_df, max_df, max_features, parallel));
+    return rcpp_result_gen;
+END_RCPP
+}
+
+// fit_transform_impl
+S4 fit_transform_impl(SEXP vectorizer_handle, StringVector texts, double min_df, double max_df, size_t max_features, bool parallel, std::string format);
+RcppExport SEXP _txtlib_fit_transform_impl(SEXP vectorizer_handleSEXP, SEXP textsSEXP, SEXP min_dfSEXP, SEXP max_dfSEXP, SEXP max_featuresSEXP, SEXP parallelSEXP, SEXP formatSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type vectorizer_handle(vectorizer_handleSEXP);
+    Rcpp::traits::input_parameter< StringVector >::type texts(textsSEXP);
+    Rcpp::traits::input_parameter< double >::type min_df(min_dfSEXP);
+    Rcpp::traits::input_parameter< double >::type max_df(max_dfSEXP);
+    Rcpp::traits::input_parameter< size_t >::type max_features(max_featuresSEXP);
+    Rcpp::traits::input_parameter< bool >::type parallel(parallelSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    rcpp_result_gen = Rcpp::wrap(fit_transform_impl(vectorizer_handle, texts, min_df, max_df, max_features, parallel, format));
     return rcpp_result_gen;
 END_RCPP
 }
 
 static const R_CallMethodDef CallEntries[] = {
+    {"_txtlib_benchmark_utf8_decoding", (DL_FUNC) &_txtlib_benchmark_utf8_decoding, 2},
+    {"_txtlib_benchmark_word_breaks", (DL_FUNC) &_txtlib_benchmark_word_breaks, 2},
+    {"_txtlib_benchmark_general_categories", (DL_FUNC) &_txtlib_benchmark_general_categories, 2},
+    {"_txtlib_benchmark_term_hashing", (DL_FUNC) &_txtlib_benchmark_term_hashing, 2},
     {"_txtlib_icu_info", (DL_FUNC) &_txtlib_icu_info, 0},
     {"_txtlib_unicode_general_categories", (DL_FUNC) &_txtlib_unicode_general_categories, 0},
-    {"_txtlib_create_uax29_vectorizer_pointer", (DL_FUNC) &_txtlib_create_uax29_vectorizer_pointer, 11},
-    {"_txtlib_tokenize_impl", (DL_FUNC) &_txtlib_tokenize_impl, 3},
-    {"_txtlib_sentence_tokenize_impl", (DL_FUNC) &_txtlib_sentence_tokenize_impl, 3},
-    {"_txtlib_vectorize_impl", (DL_FUNC) &_txtlib_vectorize_impl, 4},
-    {"_txtlib_sentence_vectorize_impl", (DL_FUNC) &_txtlib_sentence_vectorize_impl, 4},
+    {"_txtlib_create_uax29_vectorizer_pointer", (DL_FUNC) &_txtlib_create_uax29_vectorizer_pointer, 15},
+    {"_txtlib_term_collisions_impl", (DL_FUNC) &_txtlib_term_collisions_impl, 1},
+    {"_txtlib_tokenize_impl", (DL_FUNC) &_txtlib_tokenize_impl, 4},
+    {"_txtlib_sentence_tokenize_impl", (DL_FUNC) &_txtlib_sentence_tokenize_impl, 4},
+    {"_txtlib_tokenize_spans_impl", (DL_FUNC) &_txtlib_tokenize_spans_impl, 5},
+    {"_txtlib_vectorize_impl", (DL_FUNC) &_txtlib_vectorize_impl, 5},
+    {"_txtlib_sentence_vectorize_impl", (DL_FUNC) &_txtlib_sentence_vectorize_impl, 6},
+    {"_txtlib_hash_vectorize_impl", (DL_FUNC) &_txtlib_hash_vectorize_impl, 4},
+    {"_txtlib_fit_vocabulary_impl", (DL_FUNC) &_txtlib_fit_vocabulary_impl, 6},
+    {"_txtlib_fit_transform_impl", (DL_FUNC) &_txtlib_fit_transform_impl, 7},
     {NULL, NULL, 0}
 };
 
+void register_token_list_class(DllInfo* dll);
 RcppExport void R_init_txtlib(DllInfo *dll) {
     R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
     R_useDynamicSymbols(dll, FALSE);
+    register_token_list_class(dll);
 }
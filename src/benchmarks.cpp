@@ -0,0 +1,204 @@
+// [[Rcpp::plugins(cpp11)]]
+
+#include <Rcpp.h>
+#include <chrono>
+#include <memory>
+#include <unordered_set>
+#include "murmur2.h"
+#include "utf8.h"
+#include "unicode.h"
+#include "word_segmenter.h"
+#include <unicode/brkiter.h>
+#include <unicode/utext.h>
+#include <unicode/uchar.h>
+
+using namespace Rcpp;
+
+namespace {
+
+    typedef std::chrono::steady_clock benchmark_clock;
+
+    inline double elapsed_seconds(const benchmark_clock::time_point &since) {
+        return std::chrono::duration< double >(benchmark_clock::now() - since).count();
+    }
+
+    // Word boundaries of a UTF-8 text from ICU's iterator alone, or from WordSegmenter handing dictionary text over
+    // to ICU the way UAX29Parser does.
+    void word_breaks(const std::string &text, icu::BreakIterator* breaks, UText* &utf8_text,
+                     txtlib::WordSegmenter* segmenter, std::vector< int32_t > &out) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t boundary = icu::BreakIterator::DONE;
+
+        out.clear();
+        utf8_text = utext_openUTF8(utf8_text, text.data(), text.size(), &status);
+
+        if(segmenter != nullptr) {
+            segmenter->set_text(text.data(), text.size());
+            while((boundary = segmenter->next()) >= 0) out.push_back(boundary);
+            if(boundary != txtlib::WordSegmenter::DICTIONARY_TEXT) return;
+
+            breaks->setText(utf8_text, status);
+            boundary = breaks->following(segmenter->current());
+        } else {
+            breaks->setText(utf8_text, status);
+            boundary = breaks->next();
+        }
+
+        for(; boundary != icu::BreakIterator::DONE; boundary = breaks->next()) out.push_back(boundary);
+    }
+
+    // txtlib's General Category of a code point from ICU's character properties, indexed by UCharCategory.
+    const txtlib::GeneralCategory icu_categories[U_CHAR_CATEGORY_COUNT] = {
+        txtlib::Unknown, txtlib::Lu, txtlib::Ll, txtlib::Lt, txtlib::Lm, txtlib::Lo, txtlib::Mn, txtlib::Me, txtlib::Mc,
+        txtlib::Nd, txtlib::Nl, txtlib::No, txtlib::Zs, txtlib::Zl, txtlib::Zp, txtlib::Cc, txtlib::Cf, txtlib::Co,
+        txtlib::Cs, txtlib::Pd, txtlib::Ps, txtlib::Pe, txtlib::Pc, txtlib::Po, txtlib::Sm, txtlib::Sc, txtlib::Sk,
+        txtlib::So, txtlib::Pi, txtlib::Pf
+    };
+
+}
+
+// [[Rcpp::export]]
+Rcpp::List benchmark_utf8_decoding(std::vector< std::string > texts, int iterations = 10) {
+    size_t n_bytes = 0, checksum = 0;
+    bool identical = true;
+
+    for(const std::string &text : texts) {
+        n_bytes += text.size();
+        identical = identical and txtlib::to_ws_icu(text.data(), text.size()) == txtlib::to_ws_simd(text.data(), text.size());
+    }
+
+    benchmark_clock::time_point start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::string &text : texts) checksum += txtlib::to_ws_icu(text.data(), text.size()).size();
+    const double icu_seconds = elapsed_seconds(start);
+
+    start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::string &text : texts) checksum -= txtlib::to_ws_simd(text.data(), text.size()).size();
+    const double simd_seconds = elapsed_seconds(start);
+
+    if(checksum != 0) identical = false;
+
+    return Rcpp::List::create(
+        Named("bytes") = (double) n_bytes * iterations,
+        Named("icu_seconds") = icu_seconds,
+        Named("simd_seconds") = simd_seconds,
+        Named("identical") = identical
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::List benchmark_word_breaks(std::vector< std::string > texts, int iterations = 10) {
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr< icu::BreakIterator > breaks(icu::BreakIterator::createWordInstance(icu::Locale::getRoot(), status));
+    if(U_FAILURE(status)) Rcpp::stop("Failed to create word break iterator");
+
+    UText* utf8_text = nullptr;
+    txtlib::WordSegmenter segmenter;
+    std::vector< int32_t > icu_boundaries, table_boundaries;
+    size_t n_bytes = 0;
+    bool identical = true;
+
+    for(const std::string &text : texts) {
+        n_bytes += text.size();
+        word_breaks(text, breaks.get(), utf8_text, nullptr, icu_boundaries);
+        word_breaks(text, breaks.get(), utf8_text, &segmenter, table_boundaries);
+        identical = identical and icu_boundaries == table_boundaries;
+    }
+
+    benchmark_clock::time_point start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::string &text : texts) word_breaks(text, breaks.get(), utf8_text, nullptr, icu_boundaries);
+    const double icu_seconds = elapsed_seconds(start);
+
+    start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::string &text : texts) word_breaks(text, breaks.get(), utf8_text, &segmenter, table_boundaries);
+    const double table_seconds = elapsed_seconds(start);
+
+    utext_close(utf8_text);
+
+    return Rcpp::List::create(
+        Named("bytes") = (double) n_bytes * iterations,
+        Named("icu_seconds") = icu_seconds,
+        Named("table_seconds") = table_seconds,
+        Named("identical") = identical
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::List benchmark_general_categories(std::vector< std::string > texts, int iterations = 10) {
+    std::vector< std::wstring > decoded;
+    size_t n_bytes = 0, checksum = 0;
+    bool identical = true;
+
+    for(const std::string &text : texts) {
+        n_bytes += text.size();
+        decoded.push_back(txtlib::utf8_to_ws(text));
+
+        for(wchar_t c : decoded.back())
+            identical = identical and txtlib::find_character(c)->General_Category == icu_categories[u_charType(c)];
+    }
+
+    benchmark_clock::time_point start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::wstring &text : decoded)
+            for(wchar_t c : text) checksum += icu_categories[u_charType(c)];
+    const double icu_seconds = elapsed_seconds(start);
+
+    start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::wstring &text : decoded)
+            for(wchar_t c : text) checksum -= txtlib::find_character(c)->General_Category;
+    const double table_seconds = elapsed_seconds(start);
+
+    if(checksum != 0) identical = false;
+
+    return Rcpp::List::create(
+        Named("bytes") = (double) n_bytes * iterations,
+        Named("icu_seconds") = icu_seconds,
+        Named("table_seconds") = table_seconds,
+        Named("identical") = identical
+    );
+}
+
+// [[Rcpp::export]]
+Rcpp::List benchmark_term_hashing(std::vector< std::string > terms, int iterations = 10) {
+    std::vector< std::wstring > decoded;
+    std::unordered_set< uint32_t > hashes_32;
+    std::unordered_set< uint64_t > hashes_64;
+    size_t n_bytes = 0;
+    uint64_t checksum = 0;
+
+    // Terms are hashed as tokens are, as UTF-32 (UTF-16 on Windows) code units.
+    std::unordered_set< std::string > unique_terms(terms.begin(), terms.end());
+    for(const std::string &term : unique_terms) decoded.push_back(txtlib::utf8_to_ws(term));
+
+    for(const std::wstring &term : decoded) {
+        const int length = term.size() * sizeof(wchar_t);
+        n_bytes += length;
+
+        hashes_32.insert(MurmurHash2(term.data(), length, 0));
+        hashes_64.insert(MurmurHash64A(term.data(), length, 0));
+    }
+
+    benchmark_clock::time_point start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::wstring &term : decoded) checksum += MurmurHash2(term.data(), term.size() * sizeof(wchar_t), 0);
+    const double murmur2_seconds = elapsed_seconds(start);
+
+    start = benchmark_clock::now();
+    for(int i = 0; i < iterations; ++i)
+        for(const std::wstring &term : decoded) checksum += MurmurHash64A(term.data(), term.size() * sizeof(wchar_t), 0);
+    const double murmur64_seconds = elapsed_seconds(start);
+
+    return Rcpp::List::create(
+        Named("terms") = (double) decoded.size(),
+        Named("bytes") = (double) n_bytes * iterations,
+        Named("murmur2_seconds") = murmur2_seconds,
+        Named("murmur64_seconds") = murmur64_seconds,
+        Named("murmur2_collisions") = (double) (decoded.size() - hashes_32.size()),
+        Named("murmur64_collisions") = (double) (decoded.size() - hashes_64.size()),
+        Named("checksum") = (double) (checksum & 0xFFFF)  // Keeps the hashing loops from being optimized away.
+    );
+}
@@ -0,0 +1,23 @@
+// Generated by tools/generate_case_table.py from Unicode 15.0.0 data. Do not edit by hand.
+#ifndef _CASE_TABLE_
+#define _CASE_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {
+    namespace case_folding {
+        const int BLOCK_SHIFT = 8;
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const uint8_t stage1[4352];
+        extern const uint8_t stage2[6400];
+        extern const int32_t deltas[99];
+
+        // Simple case folding of a code point minus the code point. Code points must be <= 0x10FFFF.
+        inline int32_t delta(uint32_t c) {
+            return deltas[stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)]];
+        }
+    }
+}
+
+#endif
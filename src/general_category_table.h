@@ -0,0 +1,22 @@
+// Generated by tools/generate_general_category_table.py from Unicode 15.0.0 data. Do not edit by hand.
+#ifndef _GENERAL_CATEGORY_TABLE_
+#define _GENERAL_CATEGORY_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {
+    namespace general_category {
+        const int BLOCK_SHIFT = 7;
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const uint8_t stage1[8704];
+        extern const uint8_t stage2[32512];
+
+        // Index of the General Category of a code point in unique_character_groups. Code points must be <= 0x10FFFF.
+        inline uint8_t lookup(uint32_t c) {
+            return stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)];
+        }
+    }
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "unicode.h"
+#include "word_segmenter.h"
 #include "unicode/uvernum.h"
 using namespace Rcpp;
 
@@ -9,7 +10,8 @@ Rcpp::List icu_info() {
       Named("VERSION") = U_ICU_VERSION,
       Named("VERSION_MAJOR") = U_ICU_VERSION_MAJOR_NUM,
       Named("VERSION_MINOR") = U_ICU_VERSION_MINOR_NUM,
-      Named("DATA_VERSION") = U_ICU_DATA_VERSION
+      Named("DATA_VERSION") = U_ICU_DATA_VERSION,
+      Named("WORD_BREAK_TABLE") = txtlib::word_break_table_matches_icu()
   );
 }
 
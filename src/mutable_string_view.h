@@ -319,9 +319,9 @@ public:
     }
 
 
-    // Hashing
+    // Hashing. 64 bits, as vocabularies of millions of terms would have many 32 bits collisions.
     size_type hash() const noexcept {
-        return MurmurHash2(this->_start, (this->_end - this->_start) * sizeof(value_type), 0);
+        return static_cast< size_type >(MurmurHash64A(this->_start, (this->_end - this->_start) * sizeof(value_type), 0));
     }
 
 
@@ -8,29 +8,23 @@
 
 namespace txtlib {
 
+// An n-gram: a run of consecutive tokens owned by its generator, with its hash, computed by the generator from the
+// tokens' hashes.
 class NGramView {
 public:
-    std::vector< mutable_wstring_view > tokens;
+    const mutable_wstring_view *tokens;
 
-    NGramView(const std::vector< mutable_wstring_view > &ngram_tokens) : tokens(ngram_tokens) {};
+    NGramView(const mutable_wstring_view *ngram_tokens, size_t n_tokens, size_t ngram_hash) :
+        tokens(ngram_tokens), n_tokens(n_tokens), ngram_hash(ngram_hash) {};
 
-    NGramView(std::vector< mutable_wstring_view >::iterator begin,
-              std::vector< mutable_wstring_view >::iterator end) : tokens(begin, end) {};
-
-
-    NGramView(std::vector< mutable_wstring_view >::reverse_iterator begin,
-              std::vector< mutable_wstring_view >::reverse_iterator end) : tokens(begin, end) {};
-
-    size_t size() const { return this->tokens.size(); }
-
-    size_t hash() const {
-        size_t seed = 0;
+    NGramView(const std::vector< mutable_wstring_view > &ngram_tokens) :
+        tokens(ngram_tokens.data()), n_tokens(ngram_tokens.size()), ngram_hash(0) {
+        for(const auto &t : ngram_tokens) ngram_hash_combine(this->ngram_hash, t.hash());
+    };
 
-        for(const auto &t : this->tokens)
-            this->hash_combine(seed, t);
+    size_t size() const { return this->n_tokens; }
 
-        return seed;
-    }
+    size_t hash() const { return this->ngram_hash; }
 
     std::wstring as_string() const {
         if(this->size() == 0) return L"";
@@ -44,52 +38,81 @@ public:
 
         return out;
     }
+
 private:
-    void hash_combine(size_t &seed, const mutable_wstring_view &v) const {
-        // From Boost: https://docs.huihoo.com/boost/1-33-1/doc/html/hash_combine.html
-        seed ^= v.hash() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
+    size_t n_tokens;
+    size_t ngram_hash;
 };
 
 
+// Emits the n-grams (from bigrams up to ngrams_size tokens) ending at each token. The last tokens are kept in a ring
+// buffer written twice, at i and i + ngrams_size, so the tokens of any n-gram ending at the current one are contiguous.
+// Each buffered token also keeps the hash of the n-gram starting at it, extended with every new token's hash (which is
+// computed once) the way TermDictionary::hash folds n-gram hashes. Nothing is allocated after construction.
+//
+// When only vocabulary terms are counted, n-grams that aren't a prefix of a vocabulary n-gram are neither looked up
+// nor extended with the next tokens.
 template < class document_vector_t >
 class NGramsGenerator {
 public:
-    virtual ~NGramsGenerator() {};
-
     NGramsGenerator(UAX29Vectorizer *_vectorizer) : vectorizer(_vectorizer) {
         this->ngrams_size = _vectorizer->ngrams_size;
-        this->tokens_buffer.reserve(this->ngrams_size);
+        this->tokens_buffer.resize(2 * this->ngrams_size);
+        this->ngram_hashes.resize(this->ngrams_size);
+        this->viable.resize(this->ngrams_size);
     };
 
-    virtual void create_ngrams(const mutable_wstring_view &current_token, document_vector_t& document) {
-        // If the buffer has ngram_size elements, delete the first (oldest) token.
-        if(tokens_buffer.size() == ngrams_size) tokens_buffer.erase(tokens_buffer.begin());
-        tokens_buffer.push_back(current_token);
-
-        if(tokens_buffer.size() > 1) {
-            for(size_t token_idx = tokens_buffer.size() - 1; token_idx > 0; token_idx--) {
-                NGramView ngram(tokens_buffer.begin() + (token_idx - 1), tokens_buffer.end());
-                vectorizer->put_token(ngram, document);
+    void create_ngrams(const mutable_wstring_view &current_token, document_vector_t& document) {
+        const bool pruned = counts_vocabulary_terms< document_vector_t >::value;
+        const size_t token_hash = current_token.hash();
+        const size_t position = this->n_tokens % this->ngrams_size;
+
+        this->tokens_buffer[position] = current_token;
+        this->tokens_buffer[position + this->ngrams_size] = current_token;
+        this->ngram_hashes[position] = 0;
+        this->viable[position] = true;
+
+        const size_t n_buffered = std::min(this->n_tokens + 1, this->ngrams_size);
+        const mutable_wstring_view *last_token = &this->tokens_buffer[position + this->ngrams_size];
+
+        // N-grams starting at the previous tokens, from the most recent one (bigram) to the oldest one.
+        for(size_t length = 1; length <= n_buffered; ++length) {
+            const size_t start = (position + this->ngrams_size + 1 - length) % this->ngrams_size;
+            if(pruned and !this->viable[start]) continue;
+
+            size_t &ngram_hash = this->ngram_hashes[start];
+            ngram_hash_combine(ngram_hash, token_hash);
+
+            // N-grams of ngrams_size tokens won't be extended, so they are looked up directly.
+            if(pruned and length < this->ngrams_size) {
+                this->viable[start] = vectorizer->ngram_prefixes.contains(ngram_hash);
+                if(!this->viable[start]) continue;
             }
+
+            if(length > 1) vectorizer->put_token(NGramView(last_token + 1 - length, length, ngram_hash), document);
         }
+
+        ++this->n_tokens;
     }
 
-    virtual void reset() {
-        this->tokens_buffer.clear();
+    void reset() {
+        this->n_tokens = 0;
     }
 
 protected:
     UAX29Vectorizer *vectorizer;
     size_t ngrams_size;
+    size_t n_tokens = 0;  // Tokens seen since the last reset.
     std::vector< mutable_wstring_view > tokens_buffer;
+    std::vector< size_t > ngram_hashes;  // Hash of the n-gram from each buffered token to the last one.
+    std::vector< char > viable;  // Whether that n-gram is the prefix of a vocabulary n-gram.
 };
 
 
 template < class document_vector_t >
-class NoOpNGramsGenerator : public NGramsGenerator< document_vector_t > {
+class NoOpNGramsGenerator {
 public:
-    using NGramsGenerator< document_vector_t >::NGramsGenerator;
+    NoOpNGramsGenerator(UAX29Vectorizer *_vectorizer) {};
 
     void create_ngrams(const mutable_wstring_view &current_token, document_vector_t& document) {}
     void reset() {}
@@ -97,26 +120,45 @@ public:
 
 
 template < class document_vector_t >
-class BigramsGenerator : public NGramsGenerator< document_vector_t > {
+class BigramsGenerator {
 public:
-    BigramsGenerator(UAX29Vectorizer *_vectorizer) : NGramsGenerator< document_vector_t >::NGramsGenerator(_vectorizer) {
-        this->tokens_buffer = std::vector< mutable_wstring_view >(2);
-    };
+    BigramsGenerator(UAX29Vectorizer *_vectorizer) : vectorizer(_vectorizer) {};
 
     void create_ngrams(const mutable_wstring_view &current_token, document_vector_t& document) {
-        this->tokens_buffer[1] = this->tokens_buffer[0];
-        this->tokens_buffer[0] = current_token;
+        const size_t token_hash = current_token.hash();
 
-        if(this->tokens_buffer[1].length() > 0) {
-            NGramView ngram(this->tokens_buffer.rbegin(), this->tokens_buffer.rend());
-            this->vectorizer->put_token(ngram, document);
+        this->tokens[0] = this->tokens[1];
+        this->tokens[1] = current_token;
+
+        // When only vocabulary terms are counted, bigrams are only looked up after the first token of a vocabulary one.
+        if(this->has_previous and this->previous_viable) {
+            size_t ngram_hash = 0;
+            ngram_hash_combine(ngram_hash, this->previous_hash);
+            ngram_hash_combine(ngram_hash, token_hash);
+
+            this->vectorizer->put_token(NGramView(this->tokens, 2, ngram_hash), document);
+        }
+
+        this->previous_hash = token_hash;
+        this->has_previous = true;
+
+        if(counts_vocabulary_terms< document_vector_t >::value) {
+            size_t prefix_hash = 0;
+            ngram_hash_combine(prefix_hash, token_hash);
+            this->previous_viable = this->vectorizer->ngram_prefixes.contains(prefix_hash);
         }
     }
 
     void reset() {
-        this->tokens_buffer[0].clear();
-        this->tokens_buffer[1].clear();
+        this->has_previous = false;
     }
+
+private:
+    UAX29Vectorizer *vectorizer;
+    mutable_wstring_view tokens[2];
+    size_t previous_hash = 0;
+    bool has_previous = false;
+    bool previous_viable = true;
 };
 
 }
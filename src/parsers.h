@@ -8,9 +8,18 @@
 #include <iterator>
 #include <iostream>
 #include <array>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
 #include "unicode.h"
+#include "utf8.h"
+#include "word_segmenter.h"
 #include <unicode/brkiter.h>
+#include <unicode/rbbi.h>
 #include <unicode/unistr.h>
+#include <unicode/utext.h>
+#include <unicode/utf8.h>
 
 
 #if PARSER_PROFILE
@@ -32,12 +41,61 @@ namespace txtlib {
                 unsigned int uid;
                 bool new_sentence = false;
                 unsigned long token_mask = 0;
+                int32_t rule_status = UBRK_WORD_NONE;  // ICU word rule status: none, number, letter, kana or ideo.
 
                 IToken(string_t tok, int start, int end): token(tok), start_position(start), end_position(end), uid(0) {};
                 IToken(string_t tok, int start, int end, unsigned int id): token(tok), start_position(start), end_position(end), uid(id) {};
                 IToken() {};
         };
 
+    // Whether a word break iterator runs ICU's root word rules, which WordSegmenter implements. Locales with tailored
+    // word rules keep using ICU.
+    inline bool has_root_word_rules(BreakIterator* word_breaks) {
+        static const std::string root_rules = [] {
+            UErrorCode status = U_ZERO_ERROR;
+            std::unique_ptr< BreakIterator > root(BreakIterator::createWordInstance(Locale::getRoot(), status));
+            RuleBasedBreakIterator* rules_iterator = dynamic_cast< RuleBasedBreakIterator* >(root.get());
+            if(U_FAILURE(status) or rules_iterator == nullptr) return std::string();
+
+            uint32_t length = 0;
+            const uint8_t* rules = rules_iterator->getBinaryRules(length);
+            return std::string(reinterpret_cast< const char* >(rules), length);
+        }();
+
+        RuleBasedBreakIterator* rules_iterator = dynamic_cast< RuleBasedBreakIterator* >(word_breaks);
+        if(root_rules.empty() or rules_iterator == nullptr) return false;
+
+        uint32_t length = 0;
+        const uint8_t* rules = rules_iterator->getBinaryRules(length);
+        return length == root_rules.size() and std::memcmp(rules, root_rules.data(), length) == 0;
+    }
+
+    enum class BreakIteratorType { WORD, SENTENCE };
+
+    // Returns a clone of the process-wide prototype iterator for a type and locale, or nullptr if ICU can't create
+    // it. Creating an iterator loads and compiles ICU's rule data, so parsers only pay for that once per locale.
+    inline BreakIterator* clone_break_iterator(BreakIteratorType type, const std::string &locale) {
+        static std::mutex prototypes_mutex;
+        static std::map< std::pair< BreakIteratorType, std::string >, std::unique_ptr< BreakIterator > > prototypes;
+
+        std::lock_guard< std::mutex > lock(prototypes_mutex);
+        std::unique_ptr< BreakIterator > &prototype = prototypes[std::make_pair(type, locale)];
+
+        if(!prototype) {
+            UErrorCode status = U_ZERO_ERROR;
+
+            if(type == BreakIteratorType::WORD) prototype.reset(BreakIterator::createWordInstance(locale.c_str(), status));
+            else prototype.reset(BreakIterator::createSentenceInstance(locale.c_str(), status));
+
+            if(U_FAILURE(status)) {
+                prototype.reset();
+                return nullptr;
+            }
+        }
+
+        return prototype->clone();
+    }
+
     template <class string_t = std::wstring>
     class TokenParser {
         public:
@@ -57,10 +115,11 @@ namespace txtlib {
     template <class string_t = std::wstring>
         class UAX29Parser : public TokenParser<string_t> {
             typedef TokenParser<string_t> super;
+            typedef typename string_t::value_type char_t;
             const std::string locale_str;
 
             public:
-                UAX29Parser(const std::string& locale = "") {
+                UAX29Parser(const std::string& locale = "") : locale_str(locale) {
                     this->init_break_iterators();
                 }
 
@@ -72,10 +131,13 @@ namespace txtlib {
                 ~UAX29Parser() {
                     delete this->word_breaks;
                     delete this->sentence_breaks;
+                    utext_close(this->utf8_text);
                 }
 
                 void set_str(const string_t &_str) {
                     this->str = &_str;
+                    this->utf8_str = nullptr;
+                    this->word_segmenter_active = false;
                     this->input_length = this->str->length();
                     this->n_char_left = this->input_length;
                     this->current_position = 0;
@@ -84,42 +146,171 @@ namespace txtlib {
                     static_assert(alignof(std::wstring::value_type) == alignof(UChar32), "");
                     this->u_str = UnicodeString::fromUTF32(reinterpret_cast<const UChar32 *>(this->str->data()), this->str->length());
 
+                    this->split_sentences = true;
+                    this->init_sentence_iterator();
+
                     this->word_breaks->setText(this->u_str);
                     this->sentence_breaks->setText(this->u_str);
 
                     this->next_word_break = this->word_breaks->next();
-                    this->next_sentence_break = this->sentence_breaks->next();;
+                    this->next_word_status = this->word_breaks->getRuleStatus();
+                    this->next_sentence_break = this->sentence_breaks->next();
+
+                    this->current_char = txtlib::unknown_char;
+                }
+
+                // Attaches the break iterators to UTF-8 text through a UText, without copying it. Token positions are
+                // byte offsets into utf8 and tokens are only widened to string_t when token() is called. Without
+                // split_sentences the text is never run through the sentence iterator and no token starts a sentence.
+                void set_utf8(const char* utf8, size_t length, bool split_sentences = true) {
+                    UErrorCode open_status = U_ZERO_ERROR;
+
+                    this->str = nullptr;
+                    this->utf8_str = utf8;
+                    this->input_length = length;
+                    this->n_char_left = length;
+                    this->current_position = 0;
+
+                    this->utf8_text = utext_openUTF8(this->utf8_text, utf8, length, &open_status);
+                    if(U_FAILURE(open_status)) throw std::runtime_error("Failed to open UTF-8 text");
+
+                    // Word boundaries come from the table-driven segmenter when the locale uses the root rules. ICU's
+                    // iterator only gets the text if the segmenter hands the document over.
+                    this->word_segmenter_active = this->table_word_breaks;
+                    if(this->word_segmenter_active) this->word_segmenter.set_text(utf8, length);
+                    else this->word_breaks->setText(this->utf8_text, open_status);
+
+                    this->split_sentences = split_sentences;
+                    if(this->split_sentences) {
+                        this->init_sentence_iterator();
+                        this->sentence_breaks->setText(this->utf8_text, open_status);
+                    }
+                    if(U_FAILURE(open_status)) throw std::runtime_error("Failed to attach UTF-8 text to break iterators");
+
+                    this->next_word_break = this->following_word_break();
+                    this->next_sentence_break = this->split_sentences ? this->sentence_breaks->next() : BreakIterator::DONE;
+
+                    // Tokens never have more code points than the text has bytes, so views into this buffer stay
+                    // valid until the next document is set.
+                    if(this->wide_buffer.size() < length) this->wide_buffer.resize(length);
+                    this->wide_length = 0;
 
                     this->current_char = txtlib::unknown_char;
                 }
 
+                // Current token as a string_t. For UTF-8 input, widens it into the parser's buffer the first time.
+                const string_t& token() {
+                    if(this->utf8_str != nullptr and !this->token_widened) {
+                        char_t* out = &this->wide_buffer[this->wide_length];
+                        const size_t token_bytes = this->current_token.end_position - this->current_token.start_position;
+                        const size_t token_length = decode_utf8(this->utf8_str + this->current_token.start_position, token_bytes, out);
+
+                        this->current_token.token = string_t(out, token_length);
+                        this->wide_length += token_length;
+                        this->token_widened = true;
+                    }
+
+                    return this->current_token.token;
+                }
+
             protected:
                 size_t current_position = 0UL;
                 size_t n_char_left = 0UL;
                 size_t input_length = 0UL;
                 bool new_sentence_flag = false;
+                bool split_sentences = true;
 
                 const UnicodeData* current_char;
 
                 UErrorCode status = U_ZERO_ERROR;
                 BreakIterator* word_breaks;
-                BreakIterator* sentence_breaks;
+                BreakIterator* sentence_breaks = nullptr;  // Created for the first text split into sentences.
                 UnicodeString u_str;
 
+                // UTF-8 input.
+                const char* utf8_str = nullptr;
+                UText* utf8_text = nullptr;
+                std::vector< char_t > wide_buffer;
+                size_t wide_length = 0UL;
+                bool token_widened = false;
+
+                // Table-driven word boundaries, for UTF-8 input and locales with the root word rules.
+                WordSegmenter word_segmenter;
+                bool table_word_breaks = false;
+                bool word_segmenter_active = false;
+
                 size_t next_word_break = 0UL;
                 size_t next_sentence_break = 0UL;
+                int32_t word_status = UBRK_WORD_NONE;       // Rule status of the segment ending at the last boundary.
+                int32_t next_word_status = UBRK_WORD_NONE;  // Rule status of the segment ending at next_word_break.
+                bool rule_status_classification = false;
+
+                // Last non-ASCII character read and its Unicode data.
+                UChar32 last_code = -1;
+                const UnicodeData* last_char = txtlib::unknown_char;
 
             void init_break_iterators() {
-                this->word_breaks = BreakIterator::createWordInstance(this->locale_str.c_str(), status);
-                if(U_FAILURE(status)) throw std::invalid_argument("Failed to create word break iterator with locale: '" + this->locale_str + "'");
+                this->word_breaks = clone_break_iterator(BreakIteratorType::WORD, this->locale_str);
+                if(this->word_breaks == nullptr) throw std::invalid_argument("Failed to create word break iterator with locale: '" + this->locale_str + "'");
+
+                this->table_word_breaks = word_break_table_matches_icu() and has_root_word_rules(this->word_breaks);
+            }
+
+            void init_sentence_iterator() {
+                if(this->sentence_breaks != nullptr) return;
+
+                this->sentence_breaks = clone_break_iterator(BreakIteratorType::SENTENCE, this->locale_str);
+                if(this->sentence_breaks == nullptr) throw std::invalid_argument("Failed to create sentence break iterator with locale: '" + this->locale_str + "'");
+            }
+
+            // Next word boundary. Documents with characters that ICU segments with dictionaries are handed over to
+            // ICU at the segmenter's last boundary.
+            size_t following_word_break() {
+                int32_t boundary;
+
+                if(this->word_segmenter_active) {
+                    boundary = this->word_segmenter.next();
+
+                    if(boundary != WordSegmenter::DICTIONARY_TEXT) {
+                        this->next_word_status = this->word_segmenter.rule_status();
+                        return boundary;
+                    }
+
+                    UErrorCode text_status = U_ZERO_ERROR;
+                    this->word_segmenter_active = false;
+                    this->word_breaks->setText(this->utf8_text, text_status);
+                    if(U_FAILURE(text_status)) throw std::runtime_error("Failed to attach UTF-8 text to break iterators");
+
+                    boundary = this->word_breaks->following(this->word_segmenter.current());
+                } else {
+                    boundary = this->word_breaks->next();
+                }
 
-                this->sentence_breaks = BreakIterator::createSentenceInstance(this->locale_str.c_str(), status);
-                if(U_FAILURE(status)) throw std::invalid_argument("Failed to create sentence break iterator with locale: '" + this->locale_str + "'");
+                this->next_word_status = this->word_breaks->getRuleStatus();
+                return boundary;
             }
 
             void read_char() {
-                this->current_char = find_character(this->str->data()[this->current_position]);
-                this->current_position++;
+                if(this->utf8_str != nullptr) {
+                    UChar32 code = static_cast< uint8_t >(this->utf8_str[this->current_position]);
+
+                    if(code < 0x80) {
+                        this->current_char = find_character(static_cast< wchar_t >(code));
+                        this->current_position++;
+                    } else {
+                        U8_NEXT(this->utf8_str, this->current_position, this->input_length, code);
+
+                        // Runs of the same character (spaces, dashes, repeated punctuation) skip the category lookup.
+                        if(code != this->last_code) {
+                            this->last_code = code;
+                            this->last_char = find_character(static_cast< wchar_t >(code));
+                        }
+                        this->current_char = this->last_char;
+                    }
+                } else {
+                    this->current_char = find_character(this->str->data()[this->current_position]);
+                    this->current_position++;
+                }
             }
 
             bool is_sentence_break() {
@@ -131,13 +322,45 @@ namespace txtlib {
 
             bool is_word_break() {
                 if(this->current_position < this->next_word_break) return false;
-                this->next_word_break = this->word_breaks->next();
+                this->word_status = this->next_word_status;
+                this->next_word_break = this->following_word_break();
 
                 return this->current_position > 0;
             }
 
+            // Moves straight to the next word boundary, for rule status classification of UTF-8 text.
+            bool next_classified_token() {
+                const size_t token_start_position = this->current_position;
+                const bool new_sentence = this->new_sentence_flag;
+
+                this->new_sentence_flag = false;
+                if(this->current_position >= this->input_length) return false;
+
+                this->current_position = std::min(this->next_word_break, this->input_length);
+                this->word_status = this->next_word_status;
+                this->next_word_break = this->following_word_break();
+
+                while(this->split_sentences and this->current_position >= this->next_sentence_break) {
+                    this->new_sentence_flag = true;
+                    this->next_sentence_break = this->sentence_breaks->next();
+                }
+
+                this->current_token = IToken< string_t >(string_t(), token_start_position, this->current_position);
+                this->current_token.new_sentence = new_sentence;
+                this->current_token.rule_status = this->word_status;
+                this->token_widened = false;
+
+                return true;
+            }
+
         public:
+            // With rule status classification, tokens only get ICU's rule_status and no token_mask, so UTF-8 text is
+            // segmented without looking up the General Category of every character.
+            void classify_by_rule_status(bool enabled) { this->rule_status_classification = enabled; }
+
             bool has_tokens() {
+                if(this->rule_status_classification and this->utf8_str != nullptr) return this->next_classified_token();
+
                 const size_t token_start_position = this->current_position;
                 const bool new_sentence = this->new_sentence_flag;
                 uint64_t token_mask = 0;
@@ -148,17 +371,23 @@ namespace txtlib {
                     read_char();
 
                     token_mask = token_mask | this->current_char->General_Category;
-                    this->new_sentence_flag = this->new_sentence_flag or this->is_sentence_break();
+                    if(this->split_sentences) this->new_sentence_flag = this->new_sentence_flag or this->is_sentence_break();
                     const bool is_word_break = this->is_word_break();
 
                     if(is_word_break) {
                         size_t token_size = this->current_position - token_start_position;
 
-                        string_t t(&(*this->str)[token_start_position], token_size);
-                        this->current_token = IToken< string_t >(t, token_start_position, this->current_position);
+                        if(this->utf8_str != nullptr) {
+                            this->current_token = IToken< string_t >(string_t(), token_start_position, this->current_position);
+                            this->token_widened = false;
+                        } else {
+                            string_t t(&(*this->str)[token_start_position], token_size);
+                            this->current_token = IToken< string_t >(t, token_start_position, this->current_position);
+                        }
 
                         this->current_token.new_sentence = new_sentence;
                         this->current_token.token_mask = token_mask;
+                        this->current_token.rule_status = this->word_status;
 
                         return true; // Word token found.
                     }
@@ -0,0 +1,198 @@
+#ifndef _PERFECT_HASH_
+#define _PERFECT_HASH_
+
+#include <RcppParallel.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include <sparsepp/spp.h>
+
+namespace txtlib {
+
+    // Minimal perfect hash function of a fixed set of distinct 64 bits keys, mapping them to [0, number of keys)
+    // (BBHash: https://arxiv.org/abs/1702.03154). Each level is a bit array of GAMMA bits per key left: keys that
+    // don't share their bit with another key set it and the rest move on to the next level. A key's index is the
+    // rank of its bit over all levels. Other keys map to an arbitrary index or to NOT_FOUND, so callers must check
+    // the key they find there.
+    //
+    // Bits are stored in cache line sized blocks that start with the rank of their first bit and of each of their
+    // words, so a level probe and its rank touch a single cache line and take a single popcount.
+    class MinimalPerfectHash {
+    public:
+        static const size_t NOT_FOUND = static_cast< size_t >(-1);
+
+        MinimalPerfectHash() {};
+
+        // Levels are filled in parallel, keys setting their bits with atomic operations.
+        MinimalPerfectHash(const std::vector< uint64_t > &keys) : n_keys(keys.size()) {
+            std::vector< uint64_t > level_keys(keys), next_level_keys;
+
+            for(size_t level = 0; level < MAX_LEVELS and !level_keys.empty(); ++level) {
+                const size_t n_blocks = (GAMMA * level_keys.size() + BLOCK_BITS - 1) / BLOCK_BITS;
+                const size_t n_words = n_blocks * BLOCK_WORDS;
+                std::unique_ptr< std::atomic< uint64_t >[] > seen(new std::atomic< uint64_t >[n_words]);
+                std::unique_ptr< std::atomic< uint64_t >[] > collided(new std::atomic< uint64_t >[n_words]);
+
+                for(size_t w = 0; w < n_words; ++w) {
+                    seen[w].store(0, std::memory_order_relaxed);
+                    collided[w].store(0, std::memory_order_relaxed);
+                }
+
+                LevelWorker worker(level_keys, level, n_blocks * BLOCK_BITS, seen.get(), collided.get());
+                RcppParallel::parallelFor(0, level_keys.size(), worker, 10000);
+
+                this->level_offsets.push_back(this->blocks.size());
+                this->level_sizes.push_back(n_blocks * BLOCK_BITS);
+
+                for(size_t b = 0; b < n_blocks; ++b) {
+                    Block block;
+                    for(size_t w = 0; w < BLOCK_WORDS; ++w) {
+                        const size_t word = b * BLOCK_WORDS + w;
+                        block.bits[w] = seen[word].load(std::memory_order_relaxed) & ~collided[word].load(std::memory_order_relaxed);
+                    }
+                    this->blocks.push_back(block);
+                }
+
+                next_level_keys.clear();
+                for(uint64_t key : level_keys) {
+                    const size_t position = level_position(key, level, n_blocks * BLOCK_BITS);
+                    if(collided[position / 64].load(std::memory_order_relaxed) & (1ULL << (position % 64)))
+                        next_level_keys.push_back(key);
+                }
+
+                level_keys.swap(next_level_keys);
+            }
+
+            size_t rank = 0;
+            for(Block &block : this->blocks) {
+                block.rank = rank;
+                block.word_ranks = 0;
+
+                for(size_t w = 0, block_rank = 0; w < BLOCK_WORDS; ++w) {
+                    block.word_ranks |= static_cast< uint64_t >(block_rank) << (WORD_RANK_BITS * w);
+                    block_rank += popcount(block.bits[w]);
+                }
+
+                for(size_t w = 0; w < BLOCK_WORDS; ++w) rank += popcount(block.bits[w]);
+            }
+
+            // Keys still colliding after the last level (very unlikely) take the last indexes.
+            for(uint64_t key : level_keys) this->fallback[key] = rank++;
+        }
+
+        size_t size() const { return this->n_keys; }
+
+        size_t operator()(uint64_t key) const {
+            for(size_t level = 0; level < this->level_sizes.size(); ++level) {
+                const size_t position = level_position(key, level, this->level_sizes[level]);
+                const Block &block = this->blocks[this->level_offsets[level] + position / BLOCK_BITS];
+                const size_t word = (position % BLOCK_BITS) / 64;
+                const uint64_t mask = 1ULL << (position % 64);
+
+                if(block.bits[word] & mask) {
+                    const size_t word_rank = (block.word_ranks >> (WORD_RANK_BITS * word)) & ((1ULL << WORD_RANK_BITS) - 1);
+                    return block.rank + word_rank + popcount(block.bits[word] & (mask - 1));
+                }
+            }
+
+            if(this->fallback.empty()) return NOT_FOUND;
+
+            auto item = this->fallback.find(key);
+            return item != this->fallback.end() ? item->second : NOT_FOUND;
+        }
+
+    private:
+        static const size_t GAMMA = 2;
+        static const size_t MAX_LEVELS = 32;
+        static const size_t BLOCK_WORDS = 6;
+        static const size_t BLOCK_BITS = BLOCK_WORDS * 64;
+        static const size_t WORD_RANK_BITS = 9;  // Enough for the up to 320 bits before a block's last word.
+
+        struct Block {
+            uint64_t rank;  // Number of set bits in the previous blocks, of all levels.
+            uint64_t word_ranks;  // Number of set bits before each word of the block, WORD_RANK_BITS bits each.
+            uint64_t bits[BLOCK_WORDS];
+        };
+
+        size_t n_keys = 0;
+        std::vector< Block > blocks;  // Blocks of all levels, back to back.
+        std::vector< size_t > level_offsets;  // First block of each level.
+        std::vector< size_t > level_sizes;  // Bits of each level.
+        spp::sparse_hash_map< uint64_t, size_t > fallback;
+
+        static inline int popcount(uint64_t x) { return __builtin_popcountll(x); }
+
+        // Keys are already hashes: they are remixed with a seed per level (MurmurHash3's 64 bits finalizer) and mapped
+        // to the level's bits with a multiplication instead of a modulo.
+        static inline size_t level_position(uint64_t key, size_t level, size_t level_size) {
+            key ^= 0x9e3779b97f4a7c15ULL * (level + 1);
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ULL;
+            key ^= key >> 33;
+
+#if defined(__SIZEOF_INT128__)
+            return static_cast< size_t >((static_cast< unsigned __int128 >(key) * level_size) >> 64);
+#else
+            return key % level_size;
+#endif
+        }
+
+        struct LevelWorker : public RcppParallel::Worker {
+            const std::vector< uint64_t > &keys;
+            const size_t level;
+            const size_t n_bits;
+            std::atomic< uint64_t > *seen;
+            std::atomic< uint64_t > *collided;
+
+            LevelWorker(const std::vector< uint64_t > &keys, size_t level, size_t n_bits,
+                        std::atomic< uint64_t > *seen, std::atomic< uint64_t > *collided) :
+                keys(keys), level(level), n_bits(n_bits), seen(seen), collided(collided) {};
+
+            void operator()(size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i) {
+                    const size_t position = level_position(keys[i], level, n_bits);
+                    const uint64_t mask = 1ULL << (position % 64);
+
+                    if(seen[position / 64].fetch_or(mask, std::memory_order_relaxed) & mask)
+                        collided[position / 64].fetch_or(mask, std::memory_order_relaxed);
+                }
+            }
+        };
+    };
+
+    // Set of 64 bits hashes, each stored at its minimal perfect hash slot: a membership test is a perfect hash lookup
+    // and one comparison.
+    class PerfectHashSet {
+    public:
+        PerfectHashSet() {};
+
+        PerfectHashSet(std::vector< uint64_t > hashes) {
+            std::sort(hashes.begin(), hashes.end());
+            hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+            this->perfect_hash = MinimalPerfectHash(hashes);
+            this->hashes.resize(hashes.size());
+            for(uint64_t hash : hashes) this->hashes[this->perfect_hash(hash)] = hash;
+        }
+
+        size_t size() const { return this->hashes.size(); }
+        bool empty() const { return this->hashes.empty(); }
+
+        bool contains(uint64_t hash) const {
+            const size_t slot = this->perfect_hash(hash);
+            return slot != MinimalPerfectHash::NOT_FOUND and this->hashes[slot] == hash;
+        }
+
+    private:
+        MinimalPerfectHash perfect_hash;
+        std::vector< uint64_t > hashes;
+    };
+
+}
+
+#endif
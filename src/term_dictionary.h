@@ -0,0 +1,256 @@
+#ifndef _TERM_DICTIONARY_
+#define _TERM_DICTIONARY_
+
+#include <RcppParallel.h>
+#include <string>
+#include <vector>
+#include <cwchar>
+#include <stdexcept>
+
+#include <sparsepp/spp.h>
+
+#include "mutable_string_view.h"
+#include "perfect_hash.h"
+
+namespace txtlib {
+
+    // Folds the hashes of an n-gram's tokens, first to last and starting from 0, into the n-gram's hash.
+    inline void ngram_hash_combine(size_t &seed, size_t token_hash) {
+        // From Boost: https://docs.huihoo.com/boost/1-33-1/doc/html/hash_combine.html, with the 64 bits golden ratio.
+        seed ^= token_hash + static_cast< size_t >(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+    }
+
+    // Maps terms (single tokens or n-grams) to values. Terms are stored back to back in a single buffer and a lookup
+    // only succeeds if the term itself matches, so terms whose hashes collide are kept apart. N-gram terms are stored
+    // with their tokens joined by '_' and compared token by token.
+    template < class value_t >
+    class TermDictionary {
+    public:
+        size_t size() const { return this->entries.size(); }
+        bool empty() const { return this->entries.empty(); }
+
+        // Adds a term, or replaces the value of an equal term.
+        void insert(const mutable_wstring_view *tokens, size_t n_tokens, const value_t &value) {
+            this->value(this->find_or_insert(tokens, n_tokens, hash(tokens, n_tokens))) = value;
+        }
+
+        void insert(const mutable_wstring_view &term, const value_t &value) { this->insert(&term, 1, value); }
+
+        // Id of a term, added with a default value if the term isn't in the dictionary yet.
+        size_t find_or_insert(const mutable_wstring_view *tokens, size_t n_tokens, size_t term_hash) {
+            if(this->frozen) throw std::logic_error("can't insert terms into a frozen term dictionary");
+
+            auto item = this->index.find(term_hash);
+
+            if(item == this->index.end()) {
+                const size_t id = this->add_entry(tokens, n_tokens, value_t());
+                this->index[term_hash] = id;
+                return id;
+            }
+
+            size_t id = item->second, last = id;
+
+            for(; id != NO_ENTRY; last = id, id = this->entries[id].next)
+                if(this->matches(this->entries[id], tokens, n_tokens)) return id;
+
+            id = this->add_entry(tokens, n_tokens, value_t());
+            this->entries[last].next = id;
+            ++this->colliding_terms;
+
+            return id;
+        }
+
+        // Value of a term, or nullptr if the term isn't in the dictionary.
+        const value_t* find(const mutable_wstring_view *tokens, size_t n_tokens, size_t term_hash) const {
+            size_t id;
+
+            if(this->frozen) {
+                const size_t slot = this->perfect_hash(term_hash);
+                if(slot == MinimalPerfectHash::NOT_FOUND) return nullptr;
+                if(this->slots[slot].fingerprint != fingerprint(term_hash)) return nullptr;
+
+                id = this->slots[slot].entry;
+            } else {
+                auto item = this->index.find(term_hash);
+                if(item == this->index.end()) return nullptr;
+
+                id = item->second;
+            }
+
+            for(; id != NO_ENTRY; id = this->entries[id].next)
+                if(this->matches(this->entries[id], tokens, n_tokens)) return &this->entries[id].value;
+
+            return nullptr;
+        }
+
+        const value_t* find(const mutable_wstring_view &term) const { return this->find(&term, 1, term.hash()); }
+
+        // Terms are numbered in insertion order. A term is returned with its tokens joined by '_'.
+        std::wstring term(size_t id) const { return this->terms.substr(this->entries[id].offset, this->entries[id].length); }
+        const value_t& value(size_t id) const { return this->entries[id].value; }
+        value_t& value(size_t id) { return this->entries[id].value; }
+
+        // Adds the terms of another dictionary, combining the values of the terms in both with combine(value, other_value).
+        // Returns the id each of the other dictionary's terms has in this one.
+        template < class combine_t >
+        std::vector< size_t > merge(const TermDictionary &other, combine_t combine) {
+            if(this->frozen or other.frozen) throw std::logic_error("can't merge frozen term dictionaries");
+
+            std::vector< size_t > ids(other.size());
+
+            for(const auto &item : other.index) {
+                for(size_t other_id = item.second; other_id != NO_ENTRY; other_id = other.entries[other_id].next) {
+                    const Entry &other_entry = other.entries[other_id];
+                    auto this_item = this->index.find(item.first);
+                    size_t id = NO_ENTRY, last = NO_ENTRY;
+
+                    if(this_item != this->index.end()) {
+                        for(id = this_item->second; id != NO_ENTRY; last = id, id = this->entries[id].next)
+                            if(this->same_term(this->entries[id], other, other_entry)) break;
+                    }
+
+                    if(id != NO_ENTRY) {
+                        combine(this->entries[id].value, other_entry.value);
+                        ids[other_id] = id;
+                        continue;
+                    }
+
+                    id = ids[other_id] = this->entries.size();
+                    this->entries.push_back(Entry{this->terms.size(), other_entry.length, other_entry.n_tokens, NO_ENTRY, other_entry.value});
+                    this->terms.append(other.terms, other_entry.offset, other_entry.length);
+
+                    if(last == NO_ENTRY) {
+                        this->index[item.first] = id;
+                    } else {
+                        this->entries[last].next = id;
+                        ++this->colliding_terms;
+                    }
+                }
+            }
+
+            return ids;
+        }
+
+        // Number of terms sharing their hash with another term of the dictionary, not counting the first term of each
+        // hash. Before the dictionary confirmed matches, these terms were merged with that first one.
+        size_t collisions() const { return this->colliding_terms; }
+
+        // Replaces the hash map of term hashes by a minimal perfect hash of them, for dictionaries that won't change
+        // anymore: a lookup is then one probe of the perfect hash's bit array and one of a slot, holding the term's
+        // first entry and a fingerprint of its hash that rejects most other terms without comparing them.
+        void freeze() {
+            if(this->frozen) return;
+
+            std::vector< uint64_t > hashes;
+            std::vector< uint32_t > first_entries;
+            hashes.reserve(this->index.size());
+            first_entries.reserve(this->index.size());
+
+            for(const auto &item : this->index) {
+                hashes.push_back(item.first);
+                first_entries.push_back(static_cast< uint32_t >(item.second));
+            }
+
+            this->perfect_hash = MinimalPerfectHash(hashes);
+            this->slots.resize(hashes.size());
+
+            SlotsWorker worker(*this, hashes, first_entries);
+            RcppParallel::parallelFor(0, hashes.size(), worker, 10000);
+
+            spp::sparse_hash_map< size_t, size_t >().swap(this->index);
+            this->frozen = true;
+        }
+
+        static size_t hash(const mutable_wstring_view *tokens, size_t n_tokens) {
+            if(n_tokens == 1) return tokens[0].hash();
+
+            size_t seed = 0;
+            for(size_t i = 0; i < n_tokens; ++i) ngram_hash_combine(seed, tokens[i].hash());
+
+            return seed;
+        }
+
+    private:
+        static const size_t NO_ENTRY = static_cast< size_t >(-1);
+
+        struct Entry {
+            size_t offset;    // The term spans terms[offset, offset + length).
+            size_t length;
+            size_t n_tokens;
+            size_t next;      // Next entry with the same hash (collision chain), or NO_ENTRY.
+            value_t value;
+        };
+
+        // Slot of a term hash in a frozen dictionary.
+        struct Slot {
+            uint32_t fingerprint;
+            uint32_t entry;
+        };
+
+        std::wstring terms;
+        std::vector< Entry > entries;
+        spp::sparse_hash_map< size_t, size_t > index;  // Term hash -> first entry with that hash.
+        size_t colliding_terms = 0;
+
+        bool frozen = false;
+        MinimalPerfectHash perfect_hash;
+        std::vector< Slot > slots;
+
+        static uint32_t fingerprint(size_t term_hash) { return static_cast< uint32_t >(static_cast< uint64_t >(term_hash) >> 32); }
+
+        struct SlotsWorker : public RcppParallel::Worker {
+            TermDictionary &dictionary;
+            const std::vector< uint64_t > &hashes;
+            const std::vector< uint32_t > &first_entries;
+
+            SlotsWorker(TermDictionary &dictionary, const std::vector< uint64_t > &hashes, const std::vector< uint32_t > &first_entries) :
+                dictionary(dictionary), hashes(hashes), first_entries(first_entries) {};
+
+            // Each hash has its own slot, so workers never write to the same one.
+            void operator()(size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i)
+                    dictionary.slots[dictionary.perfect_hash(hashes[i])] = Slot{fingerprint(hashes[i]), first_entries[i]};
+            }
+        };
+
+        size_t add_entry(const mutable_wstring_view *tokens, size_t n_tokens, const value_t &value) {
+            const size_t offset = this->terms.size();
+
+            for(size_t i = 0; i < n_tokens; ++i) {
+                if(i > 0) this->terms.push_back(L'_');
+                this->terms.append(tokens[i].data(), tokens[i].size());
+            }
+
+            this->entries.push_back(Entry{offset, this->terms.size() - offset, n_tokens, NO_ENTRY, value});
+            return this->entries.size() - 1;
+        }
+
+        bool same_term(const Entry &entry, const TermDictionary &other, const Entry &other_entry) const {
+            return entry.n_tokens == other_entry.n_tokens and entry.length == other_entry.length and
+                std::wmemcmp(this->terms.data() + entry.offset, other.terms.data() + other_entry.offset, entry.length) == 0;
+        }
+
+        // Tokens are compared to the stored term one after the other. A token containing '_' can't make a different
+        // n-gram match: equal joined strings with as many tokens have their '_' at the same places.
+        bool matches(const Entry &entry, const mutable_wstring_view *tokens, size_t n_tokens) const {
+            if(entry.n_tokens != n_tokens) return false;
+
+            const wchar_t *term = this->terms.data() + entry.offset, *term_end = term + entry.length;
+
+            for(size_t i = 0; i < n_tokens; ++i) {
+                if(i > 0 and (term == term_end or *term++ != L'_')) return false;
+
+                const size_t token_size = tokens[i].size();
+                if(static_cast< size_t >(term_end - term) < token_size) return false;
+                if(std::wmemcmp(term, tokens[i].data(), token_size) != 0) return false;
+
+                term += token_size;
+            }
+
+            return term == term_end;
+        }
+    };
+
+}
+
+#endif
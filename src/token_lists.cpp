@@ -0,0 +1,179 @@
+// [[Rcpp::plugins(cpp11)]]
+
+#include "token_lists.h"
+
+#include <Rversion.h>
+
+#if defined(R_VERSION) && R_VERSION >= R_Version(3, 5, 0)
+#define TXTLIB_HAS_ALTREP 1
+#include <R_ext/Altrep.h>
+#else
+#define TXTLIB_HAS_ALTREP 0
+#endif
+
+using namespace Rcpp;
+
+namespace txtlib {
+
+#if TXTLIB_HAS_ALTREP
+
+    // Each token list is an ALTREP string vector. Its data1 is an external pointer to the arena whose tag holds the
+    // document index and whose protected value is the shared "owner" pointer. The owner frees the arena on finalization
+    // and keeps a STRSXP cache with one CHARSXP per term, created on first use. data2 holds the materialized vector
+    // once R needs a data pointer.
+    static R_altrep_class_t token_list_class;
+
+    static void finalize_arena(SEXP owner) {
+        TokenArena* arena = static_cast< TokenArena* >(R_ExternalPtrAddr(owner));
+        delete arena;
+        R_ClearExternalPtr(owner);
+    }
+
+    static inline TokenArena* token_list_arena(SEXP x) {
+        return static_cast< TokenArena* >(R_ExternalPtrAddr(R_altrep_data1(x)));
+    }
+
+    static inline size_t token_list_document(SEXP x) {
+        return static_cast< size_t >(REAL(R_ExternalPtrTag(R_altrep_data1(x)))[0]);
+    }
+
+    static SEXP token_list_term(SEXP x, uint32_t term_id) {
+        SEXP owner = R_ExternalPtrProtected(R_altrep_data1(x));
+        SEXP cache = R_ExternalPtrProtected(owner);
+        TokenArena* arena = token_list_arena(x);
+
+        if(cache == R_NilValue) {
+            const R_xlen_t n_terms = arena->terms.size();
+            cache = PROTECT(Rf_allocVector(STRSXP, n_terms));
+            for(R_xlen_t i = 0; i < n_terms; ++i) SET_STRING_ELT(cache, i, NA_STRING);  // Tokens are never NA.
+            R_SetExternalPtrProtected(owner, cache);
+            UNPROTECT(1);
+        }
+
+        SEXP term = STRING_ELT(cache, term_id);
+
+        if(term == NA_STRING) {
+            term = Rf_mkCharLenCE(arena->terms.token_data(term_id), arena->terms.token_size(term_id), CE_UTF8);
+            SET_STRING_ELT(cache, term_id, term);
+        }
+
+        return term;
+    }
+
+    static R_xlen_t token_list_length(SEXP x) {
+        return token_list_arena(x)->document_length(token_list_document(x));
+    }
+
+    static SEXP token_list_elt(SEXP x, R_xlen_t i) {
+        SEXP materialized = R_altrep_data2(x);
+        if(materialized != R_NilValue) return STRING_ELT(materialized, i);
+
+        return token_list_term(x, token_list_arena(x)->term_id(token_list_document(x), i));
+    }
+
+    static SEXP token_list_materialize(SEXP x) {
+        SEXP materialized = R_altrep_data2(x);
+        if(materialized != R_NilValue) return materialized;
+
+        const R_xlen_t n = token_list_length(x);
+        materialized = PROTECT(Rf_allocVector(STRSXP, n));
+
+        for(R_xlen_t i = 0; i < n; ++i) SET_STRING_ELT(materialized, i, token_list_elt(x, i));
+
+        R_set_altrep_data2(x, materialized);
+        UNPROTECT(1);
+
+        return materialized;
+    }
+
+    // The materialized vector is a regular character vector, so its data pointer comes from the API's read-only
+    // accessor. Its elements are only ever written through SET_STRING_ELT, as for any character vector.
+    static void* token_list_dataptr(SEXP x, Rboolean writeable) {
+        return (void*) STRING_PTR_RO(token_list_materialize(x));
+    }
+
+    static const void* token_list_dataptr_or_null(SEXP x) {
+        SEXP materialized = R_altrep_data2(x);
+        return materialized == R_NilValue ? NULL : (const void*) STRING_PTR_RO(materialized);
+    }
+
+    static void token_list_set_elt(SEXP x, R_xlen_t i, SEXP value) {
+        SET_STRING_ELT(token_list_materialize(x), i, value);
+    }
+
+    static SEXP token_list_serialized_state(SEXP x) {
+        return token_list_materialize(x);
+    }
+
+    static SEXP token_list_unserialize(SEXP altrep_class, SEXP state) {
+        return state;  // Serialized token lists come back as regular character vectors.
+    }
+
+    static Rboolean token_list_inspect(SEXP x, int pre, int deep, int pvec, void (*inspect_subtree)(SEXP, int, int, int)) {
+        Rprintf("txtlib token list (len=%d, materialized=%s)\n", (int) token_list_length(x), R_altrep_data2(x) != R_NilValue ? "T" : "F");
+        return TRUE;
+    }
+
+    Rcpp::List as_lazy_character_vectors(TokenArena *arena) {
+        const size_t n_documents = arena->size();
+
+        SEXP owner = PROTECT(R_MakeExternalPtr(arena, R_NilValue, R_NilValue));
+        R_RegisterCFinalizerEx(owner, finalize_arena, TRUE);
+
+        Rcpp::List output_list(n_documents);
+
+        for(size_t i = 0; i < n_documents; ++i) {
+            SEXP document_index = PROTECT(Rf_ScalarReal(static_cast< double >(i)));
+            SEXP data1 = PROTECT(R_MakeExternalPtr(arena, document_index, owner));
+            output_list[i] = R_new_altrep(token_list_class, data1, R_NilValue);
+            UNPROTECT(2);
+        }
+
+        UNPROTECT(1);
+        return output_list;
+    }
+
+#else
+
+    Rcpp::List as_lazy_character_vectors(TokenArena *arena) {
+        Rcpp::List output_list(arena->size());
+
+        for(size_t i = 0; i < arena->size(); ++i) {
+            Rcpp::StringVector tokens(arena->document_length(i));
+
+            for(size_t j = 0; j < arena->document_length(i); ++j) {
+                const uint32_t term_id = arena->term_id(i, j);
+                tokens[j] = Rf_mkCharLenCE(arena->terms.token_data(term_id), arena->terms.token_size(term_id), CE_UTF8);
+            }
+
+            output_list[i] = tokens;
+        }
+
+        delete arena;
+        return output_list;
+    }
+
+#endif
+
+}
+
+
+// [[Rcpp::init]]
+void register_token_list_class(DllInfo* dll) {
+#if TXTLIB_HAS_ALTREP
+    using namespace txtlib;
+
+    token_list_class = R_make_altstring_class("token_list", "txtlib", dll);
+
+    R_set_altrep_Length_method(token_list_class, token_list_length);
+    R_set_altrep_Inspect_method(token_list_class, token_list_inspect);
+    R_set_altrep_Serialized_state_method(token_list_class, token_list_serialized_state);
+    R_set_altrep_Unserialize_method(token_list_class, token_list_unserialize);
+
+    R_set_altvec_Dataptr_method(token_list_class, token_list_dataptr);
+    R_set_altvec_Dataptr_or_null_method(token_list_class, token_list_dataptr_or_null);
+
+    R_set_altstring_Elt_method(token_list_class, token_list_elt);
+    R_set_altstring_Set_elt_method(token_list_class, token_list_set_elt);
+#endif
+}
@@ -0,0 +1,76 @@
+#ifndef _TOKEN_LISTS_
+#define _TOKEN_LISTS_
+
+#include <Rcpp.h>
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include <sparsepp/spp.h>
+
+#include "murmur2.h"
+#include "vectorizers.h"
+
+namespace txtlib {
+
+    // Compact storage for the tokens of a batch of documents: every distinct term is stored once (UTF-8, back to back)
+    // and documents are runs of term ids.
+    class TokenArena {
+    public:
+        TokenizedDocument terms;
+        std::vector< uint32_t > term_ids;
+        std::vector< size_t > document_offsets;  // Document i spans term_ids[document_offsets[i], document_offsets[i + 1]).
+
+        TokenArena() : document_offsets(1, 0UL) {};
+
+        size_t size() const { return this->document_offsets.size() - 1; }
+        size_t document_length(size_t i) const { return this->document_offsets[i + 1] - this->document_offsets[i]; }
+        uint32_t term_id(size_t document, size_t token) const { return this->term_ids[this->document_offsets[document] + token]; }
+
+        void add_document(const TokenizedDocument &document) {
+            for(size_t i = 0; i < document.size(); ++i)
+                this->term_ids.push_back(this->intern(document.token_data(i), document.token_size(i)));
+
+            this->document_offsets.push_back(this->term_ids.size());
+        }
+
+    private:
+        spp::sparse_hash_map< uint32_t, uint32_t > terms_index;  // Term hash -> first term id with that hash.
+        std::vector< uint32_t > next_term;  // Next term id with the same hash (collision chain), or -1.
+
+        uint32_t intern(const char* data, size_t size) {
+            const uint32_t term_hash = MurmurHash2(data, size, 0);
+            auto item = this->terms_index.find(term_hash);
+
+            if(item != this->terms_index.end()) {
+                uint32_t id = item->second, last = id;
+
+                for(; id != static_cast< uint32_t >(-1); last = id, id = this->next_term[id])
+                    if(this->terms.token_size(id) == size and std::memcmp(this->terms.token_data(id), data, size) == 0)
+                        return id;
+
+                this->next_term[last] = this->add_term(data, size);
+                return this->next_term[last];
+            }
+
+            const uint32_t id = this->add_term(data, size);
+            this->terms_index[term_hash] = id;
+            return id;
+        }
+
+        uint32_t add_term(const char* data, size_t size) {
+            this->terms.buffer.append(data, size);
+            this->terms.end_token();
+            this->next_term.push_back(static_cast< uint32_t >(-1));
+            return static_cast< uint32_t >(this->terms.size() - 1);
+        }
+    };
+
+    // Exposes each arena document as a character vector that only builds its CHARSXPs when R asks for them. Takes
+    // ownership of the arena, which is freed once no vector references it anymore. Without ALTREP (R < 3.5.0) the
+    // vectors are built eagerly.
+    Rcpp::List as_lazy_character_vectors(TokenArena *arena);
+
+}
+
+#endif
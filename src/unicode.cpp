@@ -1,3391 +1,61 @@
 
 #include "unicode.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace txtlib {
 
-    const UnicodeData* find_character(const wchar_t &code) {
+    void to_lowercase(wchar_t* begin, wchar_t* end) {
 #if UNICODE_DEBUG
         IPROF_FUNC;
 #endif
-        if(((unsigned) code) < 256) return ascii_chars[code];
+        wchar_t* c = begin;
 
-        switch(code) {
-            case 0 ... 31: return &unique_character_groups[0];
-            case 32: return &unique_character_groups[1];
-            case 33 ... 35: return &unique_character_groups[2];
-            case 36: return &unique_character_groups[3];
-            case 37 ... 39: return &unique_character_groups[2];
-            case 40: return &unique_character_groups[4];
-            case 41: return &unique_character_groups[5];
-            case 42: return &unique_character_groups[2];
-            case 43: return &unique_character_groups[6];
-            case 44: return &unique_character_groups[2];
-            case 45: return &unique_character_groups[7];
-            case 46 ... 47: return &unique_character_groups[2];
-            case 48 ... 57: return &unique_character_groups[8];
-            case 58 ... 59: return &unique_character_groups[2];
-            case 60 ... 62: return &unique_character_groups[6];
-            case 63 ... 64: return &unique_character_groups[2];
-            case 65 ... 90: return &unique_character_groups[9];
-            case 91: return &unique_character_groups[4];
-            case 92: return &unique_character_groups[2];
-            case 93: return &unique_character_groups[5];
-            case 94: return &unique_character_groups[10];
-            case 95: return &unique_character_groups[11];
-            case 96: return &unique_character_groups[10];
-            case 97 ... 122: return &unique_character_groups[12];
-            case 123: return &unique_character_groups[4];
-            case 124: return &unique_character_groups[6];
-            case 125: return &unique_character_groups[5];
-            case 126: return &unique_character_groups[6];
-            case 127 ... 159: return &unique_character_groups[0];
-            case 160: return &unique_character_groups[1];
-            case 161: return &unique_character_groups[2];
-            case 162 ... 165: return &unique_character_groups[3];
-            case 166: return &unique_character_groups[13];
-            case 167: return &unique_character_groups[2];
-            case 168: return &unique_character_groups[10];
-            case 169: return &unique_character_groups[13];
-            case 170: return &unique_character_groups[14];
-            case 171: return &unique_character_groups[15];
-            case 172: return &unique_character_groups[6];
-            case 173: return &unique_character_groups[16];
-            case 174: return &unique_character_groups[13];
-            case 175: return &unique_character_groups[10];
-            case 176: return &unique_character_groups[13];
-            case 177: return &unique_character_groups[6];
-            case 178 ... 179: return &unique_character_groups[17];
-            case 180: return &unique_character_groups[10];
-            case 181: return &unique_character_groups[12];
-            case 182 ... 183: return &unique_character_groups[2];
-            case 184: return &unique_character_groups[10];
-            case 185: return &unique_character_groups[17];
-            case 186: return &unique_character_groups[14];
-            case 187: return &unique_character_groups[18];
-            case 188 ... 190: return &unique_character_groups[17];
-            case 191: return &unique_character_groups[2];
-            case 192 ... 214: return &unique_character_groups[9];
-            case 215: return &unique_character_groups[6];
-            case 216 ... 222: return &unique_character_groups[9];
-            case 223 ... 246: return &unique_character_groups[12];
-            case 247: return &unique_character_groups[6];
-            case 248 ... 255: return &unique_character_groups[12];
-            case 256: return &unique_character_groups[9];
-            case 257: return &unique_character_groups[12];
-            case 258: return &unique_character_groups[9];
-            case 259: return &unique_character_groups[12];
-            case 260: return &unique_character_groups[9];
-            case 261: return &unique_character_groups[12];
-            case 262: return &unique_character_groups[9];
-            case 263: return &unique_character_groups[12];
-            case 264: return &unique_character_groups[9];
-            case 265: return &unique_character_groups[12];
-            case 266: return &unique_character_groups[9];
-            case 267: return &unique_character_groups[12];
-            case 268: return &unique_character_groups[9];
-            case 269: return &unique_character_groups[12];
-            case 270: return &unique_character_groups[9];
-            case 271: return &unique_character_groups[12];
-            case 272: return &unique_character_groups[9];
-            case 273: return &unique_character_groups[12];
-            case 274: return &unique_character_groups[9];
-            case 275: return &unique_character_groups[12];
-            case 276: return &unique_character_groups[9];
-            case 277: return &unique_character_groups[12];
-            case 278: return &unique_character_groups[9];
-            case 279: return &unique_character_groups[12];
-            case 280: return &unique_character_groups[9];
-            case 281: return &unique_character_groups[12];
-            case 282: return &unique_character_groups[9];
-            case 283: return &unique_character_groups[12];
-            case 284: return &unique_character_groups[9];
-            case 285: return &unique_character_groups[12];
-            case 286: return &unique_character_groups[9];
-            case 287: return &unique_character_groups[12];
-            case 288: return &unique_character_groups[9];
-            case 289: return &unique_character_groups[12];
-            case 290: return &unique_character_groups[9];
-            case 291: return &unique_character_groups[12];
-            case 292: return &unique_character_groups[9];
-            case 293: return &unique_character_groups[12];
-            case 294: return &unique_character_groups[9];
-            case 295: return &unique_character_groups[12];
-            case 296: return &unique_character_groups[9];
-            case 297: return &unique_character_groups[12];
-            case 298: return &unique_character_groups[9];
-            case 299: return &unique_character_groups[12];
-            case 300: return &unique_character_groups[9];
-            case 301: return &unique_character_groups[12];
-            case 302: return &unique_character_groups[9];
-            case 303: return &unique_character_groups[12];
-            case 304: return &unique_character_groups[9];
-            case 305: return &unique_character_groups[12];
-            case 306: return &unique_character_groups[9];
-            case 307: return &unique_character_groups[12];
-            case 308: return &unique_character_groups[9];
-            case 309: return &unique_character_groups[12];
-            case 310: return &unique_character_groups[9];
-            case 311 ... 312: return &unique_character_groups[12];
-            case 313: return &unique_character_groups[9];
-            case 314: return &unique_character_groups[12];
-            case 315: return &unique_character_groups[9];
-            case 316: return &unique_character_groups[12];
-            case 317: return &unique_character_groups[9];
-            case 318: return &unique_character_groups[12];
-            case 319: return &unique_character_groups[9];
-            case 320: return &unique_character_groups[12];
-            case 321: return &unique_character_groups[9];
-            case 322: return &unique_character_groups[12];
-            case 323: return &unique_character_groups[9];
-            case 324: return &unique_character_groups[12];
-            case 325: return &unique_character_groups[9];
-            case 326: return &unique_character_groups[12];
-            case 327: return &unique_character_groups[9];
-            case 328 ... 329: return &unique_character_groups[12];
-            case 330: return &unique_character_groups[9];
-            case 331: return &unique_character_groups[12];
-            case 332: return &unique_character_groups[9];
-            case 333: return &unique_character_groups[12];
-            case 334: return &unique_character_groups[9];
-            case 335: return &unique_character_groups[12];
-            case 336: return &unique_character_groups[9];
-            case 337: return &unique_character_groups[12];
-            case 338: return &unique_character_groups[9];
-            case 339: return &unique_character_groups[12];
-            case 340: return &unique_character_groups[9];
-            case 341: return &unique_character_groups[12];
-            case 342: return &unique_character_groups[9];
-            case 343: return &unique_character_groups[12];
-            case 344: return &unique_character_groups[9];
-            case 345: return &unique_character_groups[12];
-            case 346: return &unique_character_groups[9];
-            case 347: return &unique_character_groups[12];
-            case 348: return &unique_character_groups[9];
-            case 349: return &unique_character_groups[12];
-            case 350: return &unique_character_groups[9];
-            case 351: return &unique_character_groups[12];
-            case 352: return &unique_character_groups[9];
-            case 353: return &unique_character_groups[12];
-            case 354: return &unique_character_groups[9];
-            case 355: return &unique_character_groups[12];
-            case 356: return &unique_character_groups[9];
-            case 357: return &unique_character_groups[12];
-            case 358: return &unique_character_groups[9];
-            case 359: return &unique_character_groups[12];
-            case 360: return &unique_character_groups[9];
-            case 361: return &unique_character_groups[12];
-            case 362: return &unique_character_groups[9];
-            case 363: return &unique_character_groups[12];
-            case 364: return &unique_character_groups[9];
-            case 365: return &unique_character_groups[12];
-            case 366: return &unique_character_groups[9];
-            case 367: return &unique_character_groups[12];
-            case 368: return &unique_character_groups[9];
-            case 369: return &unique_character_groups[12];
-            case 370: return &unique_character_groups[9];
-            case 371: return &unique_character_groups[12];
-            case 372: return &unique_character_groups[9];
-            case 373: return &unique_character_groups[12];
-            case 374: return &unique_character_groups[9];
-            case 375: return &unique_character_groups[12];
-            case 376 ... 377: return &unique_character_groups[9];
-            case 378: return &unique_character_groups[12];
-            case 379: return &unique_character_groups[9];
-            case 380: return &unique_character_groups[12];
-            case 381: return &unique_character_groups[9];
-            case 382 ... 384: return &unique_character_groups[12];
-            case 385 ... 386: return &unique_character_groups[9];
-            case 387: return &unique_character_groups[12];
-            case 388: return &unique_character_groups[9];
-            case 389: return &unique_character_groups[12];
-            case 390 ... 391: return &unique_character_groups[9];
-            case 392: return &unique_character_groups[12];
-            case 393 ... 395: return &unique_character_groups[9];
-            case 396 ... 397: return &unique_character_groups[12];
-            case 398 ... 401: return &unique_character_groups[9];
-            case 402: return &unique_character_groups[12];
-            case 403 ... 404: return &unique_character_groups[9];
-            case 405: return &unique_character_groups[12];
-            case 406 ... 408: return &unique_character_groups[9];
-            case 409 ... 411: return &unique_character_groups[12];
-            case 412 ... 413: return &unique_character_groups[9];
-            case 414: return &unique_character_groups[12];
-            case 415 ... 416: return &unique_character_groups[9];
-            case 417: return &unique_character_groups[12];
-            case 418: return &unique_character_groups[9];
-            case 419: return &unique_character_groups[12];
-            case 420: return &unique_character_groups[9];
-            case 421: return &unique_character_groups[12];
-            case 422 ... 423: return &unique_character_groups[9];
-            case 424: return &unique_character_groups[12];
-            case 425: return &unique_character_groups[9];
-            case 426 ... 427: return &unique_character_groups[12];
-            case 428: return &unique_character_groups[9];
-            case 429: return &unique_character_groups[12];
-            case 430 ... 431: return &unique_character_groups[9];
-            case 432: return &unique_character_groups[12];
-            case 433 ... 435: return &unique_character_groups[9];
-            case 436: return &unique_character_groups[12];
-            case 437: return &unique_character_groups[9];
-            case 438: return &unique_character_groups[12];
-            case 439 ... 440: return &unique_character_groups[9];
-            case 441 ... 442: return &unique_character_groups[12];
-            case 443: return &unique_character_groups[14];
-            case 444: return &unique_character_groups[9];
-            case 445 ... 447: return &unique_character_groups[12];
-            case 448 ... 451: return &unique_character_groups[14];
-            case 452: return &unique_character_groups[9];
-            case 453: return &unique_character_groups[19];
-            case 454: return &unique_character_groups[12];
-            case 455: return &unique_character_groups[9];
-            case 456: return &unique_character_groups[19];
-            case 457: return &unique_character_groups[12];
-            case 458: return &unique_character_groups[9];
-            case 459: return &unique_character_groups[19];
-            case 460: return &unique_character_groups[12];
-            case 461: return &unique_character_groups[9];
-            case 462: return &unique_character_groups[12];
-            case 463: return &unique_character_groups[9];
-            case 464: return &unique_character_groups[12];
-            case 465: return &unique_character_groups[9];
-            case 466: return &unique_character_groups[12];
-            case 467: return &unique_character_groups[9];
-            case 468: return &unique_character_groups[12];
-            case 469: return &unique_character_groups[9];
-            case 470: return &unique_character_groups[12];
-            case 471: return &unique_character_groups[9];
-            case 472: return &unique_character_groups[12];
-            case 473: return &unique_character_groups[9];
-            case 474: return &unique_character_groups[12];
-            case 475: return &unique_character_groups[9];
-            case 476 ... 477: return &unique_character_groups[12];
-            case 478: return &unique_character_groups[9];
-            case 479: return &unique_character_groups[12];
-            case 480: return &unique_character_groups[9];
-            case 481: return &unique_character_groups[12];
-            case 482: return &unique_character_groups[9];
-            case 483: return &unique_character_groups[12];
-            case 484: return &unique_character_groups[9];
-            case 485: return &unique_character_groups[12];
-            case 486: return &unique_character_groups[9];
-            case 487: return &unique_character_groups[12];
-            case 488: return &unique_character_groups[9];
-            case 489: return &unique_character_groups[12];
-            case 490: return &unique_character_groups[9];
-            case 491: return &unique_character_groups[12];
-            case 492: return &unique_character_groups[9];
-            case 493: return &unique_character_groups[12];
-            case 494: return &unique_character_groups[9];
-            case 495 ... 496: return &unique_character_groups[12];
-            case 497: return &unique_character_groups[9];
-            case 498: return &unique_character_groups[19];
-            case 499: return &unique_character_groups[12];
-            case 500: return &unique_character_groups[9];
-            case 501: return &unique_character_groups[12];
-            case 502 ... 504: return &unique_character_groups[9];
-            case 505: return &unique_character_groups[12];
-            case 506: return &unique_character_groups[9];
-            case 507: return &unique_character_groups[12];
-            case 508: return &unique_character_groups[9];
-            case 509: return &unique_character_groups[12];
-            case 510: return &unique_character_groups[9];
-            case 511: return &unique_character_groups[12];
-            case 512: return &unique_character_groups[9];
-            case 513: return &unique_character_groups[12];
-            case 514: return &unique_character_groups[9];
-            case 515: return &unique_character_groups[12];
-            case 516: return &unique_character_groups[9];
-            case 517: return &unique_character_groups[12];
-            case 518: return &unique_character_groups[9];
-            case 519: return &unique_character_groups[12];
-            case 520: return &unique_character_groups[9];
-            case 521: return &unique_character_groups[12];
-            case 522: return &unique_character_groups[9];
-            case 523: return &unique_character_groups[12];
-            case 524: return &unique_character_groups[9];
-            case 525: return &unique_character_groups[12];
-            case 526: return &unique_character_groups[9];
-            case 527: return &unique_character_groups[12];
-            case 528: return &unique_character_groups[9];
-            case 529: return &unique_character_groups[12];
-            case 530: return &unique_character_groups[9];
-            case 531: return &unique_character_groups[12];
-            case 532: return &unique_character_groups[9];
-            case 533: return &unique_character_groups[12];
-            case 534: return &unique_character_groups[9];
-            case 535: return &unique_character_groups[12];
-            case 536: return &unique_character_groups[9];
-            case 537: return &unique_character_groups[12];
-            case 538: return &unique_character_groups[9];
-            case 539: return &unique_character_groups[12];
-            case 540: return &unique_character_groups[9];
-            case 541: return &unique_character_groups[12];
-            case 542: return &unique_character_groups[9];
-            case 543: return &unique_character_groups[12];
-            case 544: return &unique_character_groups[9];
-            case 545: return &unique_character_groups[12];
-            case 546: return &unique_character_groups[9];
-            case 547: return &unique_character_groups[12];
-            case 548: return &unique_character_groups[9];
-            case 549: return &unique_character_groups[12];
-            case 550: return &unique_character_groups[9];
-            case 551: return &unique_character_groups[12];
-            case 552: return &unique_character_groups[9];
-            case 553: return &unique_character_groups[12];
-            case 554: return &unique_character_groups[9];
-            case 555: return &unique_character_groups[12];
-            case 556: return &unique_character_groups[9];
-            case 557: return &unique_character_groups[12];
-            case 558: return &unique_character_groups[9];
-            case 559: return &unique_character_groups[12];
-            case 560: return &unique_character_groups[9];
-            case 561: return &unique_character_groups[12];
-            case 562: return &unique_character_groups[9];
-            case 563 ... 569: return &unique_character_groups[12];
-            case 570 ... 571: return &unique_character_groups[9];
-            case 572: return &unique_character_groups[12];
-            case 573 ... 574: return &unique_character_groups[9];
-            case 575 ... 576: return &unique_character_groups[12];
-            case 577: return &unique_character_groups[9];
-            case 578: return &unique_character_groups[12];
-            case 579 ... 582: return &unique_character_groups[9];
-            case 583: return &unique_character_groups[12];
-            case 584: return &unique_character_groups[9];
-            case 585: return &unique_character_groups[12];
-            case 586: return &unique_character_groups[9];
-            case 587: return &unique_character_groups[12];
-            case 588: return &unique_character_groups[9];
-            case 589: return &unique_character_groups[12];
-            case 590: return &unique_character_groups[9];
-            case 591 ... 659: return &unique_character_groups[12];
-            case 660: return &unique_character_groups[14];
-            case 661 ... 687: return &unique_character_groups[12];
-            case 688 ... 705: return &unique_character_groups[20];
-            case 706 ... 709: return &unique_character_groups[10];
-            case 710 ... 721: return &unique_character_groups[20];
-            case 722 ... 735: return &unique_character_groups[10];
-            case 736 ... 740: return &unique_character_groups[20];
-            case 741 ... 747: return &unique_character_groups[10];
-            case 748: return &unique_character_groups[20];
-            case 749: return &unique_character_groups[10];
-            case 750: return &unique_character_groups[20];
-            case 751 ... 767: return &unique_character_groups[10];
-            case 768 ... 879: return &unique_character_groups[21];
-            case 880: return &unique_character_groups[9];
-            case 881: return &unique_character_groups[12];
-            case 882: return &unique_character_groups[9];
-            case 883: return &unique_character_groups[12];
-            case 884: return &unique_character_groups[20];
-            case 885: return &unique_character_groups[10];
-            case 886: return &unique_character_groups[9];
-            case 887: return &unique_character_groups[12];
-            case 890: return &unique_character_groups[20];
-            case 891 ... 893: return &unique_character_groups[12];
-            case 894: return &unique_character_groups[2];
-            case 895: return &unique_character_groups[9];
-            case 900 ... 901: return &unique_character_groups[10];
-            case 902: return &unique_character_groups[9];
-            case 903: return &unique_character_groups[2];
-            case 904 ... 906: return &unique_character_groups[9];
-            case 908: return &unique_character_groups[9];
-            case 910 ... 911: return &unique_character_groups[9];
-            case 912: return &unique_character_groups[12];
-            case 913 ... 929: return &unique_character_groups[9];
-            case 931 ... 939: return &unique_character_groups[9];
-            case 940 ... 974: return &unique_character_groups[12];
-            case 975: return &unique_character_groups[9];
-            case 976 ... 977: return &unique_character_groups[12];
-            case 978 ... 980: return &unique_character_groups[9];
-            case 981 ... 983: return &unique_character_groups[12];
-            case 984: return &unique_character_groups[9];
-            case 985: return &unique_character_groups[12];
-            case 986: return &unique_character_groups[9];
-            case 987: return &unique_character_groups[12];
-            case 988: return &unique_character_groups[9];
-            case 989: return &unique_character_groups[12];
-            case 990: return &unique_character_groups[9];
-            case 991: return &unique_character_groups[12];
-            case 992: return &unique_character_groups[9];
-            case 993: return &unique_character_groups[12];
-            case 994: return &unique_character_groups[9];
-            case 995: return &unique_character_groups[12];
-            case 996: return &unique_character_groups[9];
-            case 997: return &unique_character_groups[12];
-            case 998: return &unique_character_groups[9];
-            case 999: return &unique_character_groups[12];
-            case 1000: return &unique_character_groups[9];
-            case 1001: return &unique_character_groups[12];
-            case 1002: return &unique_character_groups[9];
-            case 1003: return &unique_character_groups[12];
-            case 1004: return &unique_character_groups[9];
-            case 1005: return &unique_character_groups[12];
-            case 1006: return &unique_character_groups[9];
-            case 1007 ... 1011: return &unique_character_groups[12];
-            case 1012: return &unique_character_groups[9];
-            case 1013: return &unique_character_groups[12];
-            case 1014: return &unique_character_groups[6];
-            case 1015: return &unique_character_groups[9];
-            case 1016: return &unique_character_groups[12];
-            case 1017 ... 1018: return &unique_character_groups[9];
-            case 1019 ... 1020: return &unique_character_groups[12];
-            case 1021 ... 1071: return &unique_character_groups[9];
-            case 1072 ... 1119: return &unique_character_groups[12];
-            case 1120: return &unique_character_groups[9];
-            case 1121: return &unique_character_groups[12];
-            case 1122: return &unique_character_groups[9];
-            case 1123: return &unique_character_groups[12];
-            case 1124: return &unique_character_groups[9];
-            case 1125: return &unique_character_groups[12];
-            case 1126: return &unique_character_groups[9];
-            case 1127: return &unique_character_groups[12];
-            case 1128: return &unique_character_groups[9];
-            case 1129: return &unique_character_groups[12];
-            case 1130: return &unique_character_groups[9];
-            case 1131: return &unique_character_groups[12];
-            case 1132: return &unique_character_groups[9];
-            case 1133: return &unique_character_groups[12];
-            case 1134: return &unique_character_groups[9];
-            case 1135: return &unique_character_groups[12];
-            case 1136: return &unique_character_groups[9];
-            case 1137: return &unique_character_groups[12];
-            case 1138: return &unique_character_groups[9];
-            case 1139: return &unique_character_groups[12];
-            case 1140: return &unique_character_groups[9];
-            case 1141: return &unique_character_groups[12];
-            case 1142: return &unique_character_groups[9];
-            case 1143: return &unique_character_groups[12];
-            case 1144: return &unique_character_groups[9];
-            case 1145: return &unique_character_groups[12];
-            case 1146: return &unique_character_groups[9];
-            case 1147: return &unique_character_groups[12];
-            case 1148: return &unique_character_groups[9];
-            case 1149: return &unique_character_groups[12];
-            case 1150: return &unique_character_groups[9];
-            case 1151: return &unique_character_groups[12];
-            case 1152: return &unique_character_groups[9];
-            case 1153: return &unique_character_groups[12];
-            case 1154: return &unique_character_groups[13];
-            case 1155 ... 1159: return &unique_character_groups[21];
-            case 1160 ... 1161: return &unique_character_groups[22];
-            case 1162: return &unique_character_groups[9];
-            case 1163: return &unique_character_groups[12];
-            case 1164: return &unique_character_groups[9];
-            case 1165: return &unique_character_groups[12];
-            case 1166: return &unique_character_groups[9];
-            case 1167: return &unique_character_groups[12];
-            case 1168: return &unique_character_groups[9];
-            case 1169: return &unique_character_groups[12];
-            case 1170: return &unique_character_groups[9];
-            case 1171: return &unique_character_groups[12];
-            case 1172: return &unique_character_groups[9];
-            case 1173: return &unique_character_groups[12];
-            case 1174: return &unique_character_groups[9];
-            case 1175: return &unique_character_groups[12];
-            case 1176: return &unique_character_groups[9];
-            case 1177: return &unique_character_groups[12];
-            case 1178: return &unique_character_groups[9];
-            case 1179: return &unique_character_groups[12];
-            case 1180: return &unique_character_groups[9];
-            case 1181: return &unique_character_groups[12];
-            case 1182: return &unique_character_groups[9];
-            case 1183: return &unique_character_groups[12];
-            case 1184: return &unique_character_groups[9];
-            case 1185: return &unique_character_groups[12];
-            case 1186: return &unique_character_groups[9];
-            case 1187: return &unique_character_groups[12];
-            case 1188: return &unique_character_groups[9];
-            case 1189: return &unique_character_groups[12];
-            case 1190: return &unique_character_groups[9];
-            case 1191: return &unique_character_groups[12];
-            case 1192: return &unique_character_groups[9];
-            case 1193: return &unique_character_groups[12];
-            case 1194: return &unique_character_groups[9];
-            case 1195: return &unique_character_groups[12];
-            case 1196: return &unique_character_groups[9];
-            case 1197: return &unique_character_groups[12];
-            case 1198: return &unique_character_groups[9];
-            case 1199: return &unique_character_groups[12];
-            case 1200: return &unique_character_groups[9];
-            case 1201: return &unique_character_groups[12];
-            case 1202: return &unique_character_groups[9];
-            case 1203: return &unique_character_groups[12];
-            case 1204: return &unique_character_groups[9];
-            case 1205: return &unique_character_groups[12];
-            case 1206: return &unique_character_groups[9];
-            case 1207: return &unique_character_groups[12];
-            case 1208: return &unique_character_groups[9];
-            case 1209: return &unique_character_groups[12];
-            case 1210: return &unique_character_groups[9];
-            case 1211: return &unique_character_groups[12];
-            case 1212: return &unique_character_groups[9];
-            case 1213: return &unique_character_groups[12];
-            case 1214: return &unique_character_groups[9];
-            case 1215: return &unique_character_groups[12];
-            case 1216 ... 1217: return &unique_character_groups[9];
-            case 1218: return &unique_character_groups[12];
-            case 1219: return &unique_character_groups[9];
-            case 1220: return &unique_character_groups[12];
-            case 1221: return &unique_character_groups[9];
-            case 1222: return &unique_character_groups[12];
-            case 1223: return &unique_character_groups[9];
-            case 1224: return &unique_character_groups[12];
-            case 1225: return &unique_character_groups[9];
-            case 1226: return &unique_character_groups[12];
-            case 1227: return &unique_character_groups[9];
-            case 1228: return &unique_character_groups[12];
-            case 1229: return &unique_character_groups[9];
-            case 1230 ... 1231: return &unique_character_groups[12];
-            case 1232: return &unique_character_groups[9];
-            case 1233: return &unique_character_groups[12];
-            case 1234: return &unique_character_groups[9];
-            case 1235: return &unique_character_groups[12];
-            case 1236: return &unique_character_groups[9];
-            case 1237: return &unique_character_groups[12];
-            case 1238: return &unique_character_groups[9];
-            case 1239: return &unique_character_groups[12];
-            case 1240: return &unique_character_groups[9];
-            case 1241: return &unique_character_groups[12];
-            case 1242: return &unique_character_groups[9];
-            case 1243: return &unique_character_groups[12];
-            case 1244: return &unique_character_groups[9];
-            case 1245: return &unique_character_groups[12];
-            case 1246: return &unique_character_groups[9];
-            case 1247: return &unique_character_groups[12];
-            case 1248: return &unique_character_groups[9];
-            case 1249: return &unique_character_groups[12];
-            case 1250: return &unique_character_groups[9];
-            case 1251: return &unique_character_groups[12];
-            case 1252: return &unique_character_groups[9];
-            case 1253: return &unique_character_groups[12];
-            case 1254: return &unique_character_groups[9];
-            case 1255: return &unique_character_groups[12];
-            case 1256: return &unique_character_groups[9];
-            case 1257: return &unique_character_groups[12];
-            case 1258: return &unique_character_groups[9];
-            case 1259: return &unique_character_groups[12];
-            case 1260: return &unique_character_groups[9];
-            case 1261: return &unique_character_groups[12];
-            case 1262: return &unique_character_groups[9];
-            case 1263: return &unique_character_groups[12];
-            case 1264: return &unique_character_groups[9];
-            case 1265: return &unique_character_groups[12];
-            case 1266: return &unique_character_groups[9];
-            case 1267: return &unique_character_groups[12];
-            case 1268: return &unique_character_groups[9];
-            case 1269: return &unique_character_groups[12];
-            case 1270: return &unique_character_groups[9];
-            case 1271: return &unique_character_groups[12];
-            case 1272: return &unique_character_groups[9];
-            case 1273: return &unique_character_groups[12];
-            case 1274: return &unique_character_groups[9];
-            case 1275: return &unique_character_groups[12];
-            case 1276: return &unique_character_groups[9];
-            case 1277: return &unique_character_groups[12];
-            case 1278: return &unique_character_groups[9];
-            case 1279: return &unique_character_groups[12];
-            case 1280: return &unique_character_groups[9];
-            case 1281: return &unique_character_groups[12];
-            case 1282: return &unique_character_groups[9];
-            case 1283: return &unique_character_groups[12];
-            case 1284: return &unique_character_groups[9];
-            case 1285: return &unique_character_groups[12];
-            case 1286: return &unique_character_groups[9];
-            case 1287: return &unique_character_groups[12];
-            case 1288: return &unique_character_groups[9];
-            case 1289: return &unique_character_groups[12];
-            case 1290: return &unique_character_groups[9];
-            case 1291: return &unique_character_groups[12];
-            case 1292: return &unique_character_groups[9];
-            case 1293: return &unique_character_groups[12];
-            case 1294: return &unique_character_groups[9];
-            case 1295: return &unique_character_groups[12];
-            case 1296: return &unique_character_groups[9];
-            case 1297: return &unique_character_groups[12];
-            case 1298: return &unique_character_groups[9];
-            case 1299: return &unique_character_groups[12];
-            case 1300: return &unique_character_groups[9];
-            case 1301: return &unique_character_groups[12];
-            case 1302: return &unique_character_groups[9];
-            case 1303: return &unique_character_groups[12];
-            case 1304: return &unique_character_groups[9];
-            case 1305: return &unique_character_groups[12];
-            case 1306: return &unique_character_groups[9];
-            case 1307: return &unique_character_groups[12];
-            case 1308: return &unique_character_groups[9];
-            case 1309: return &unique_character_groups[12];
-            case 1310: return &unique_character_groups[9];
-            case 1311: return &unique_character_groups[12];
-            case 1312: return &unique_character_groups[9];
-            case 1313: return &unique_character_groups[12];
-            case 1314: return &unique_character_groups[9];
-            case 1315: return &unique_character_groups[12];
-            case 1316: return &unique_character_groups[9];
-            case 1317: return &unique_character_groups[12];
-            case 1318: return &unique_character_groups[9];
-            case 1319: return &unique_character_groups[12];
-            case 1320: return &unique_character_groups[9];
-            case 1321: return &unique_character_groups[12];
-            case 1322: return &unique_character_groups[9];
-            case 1323: return &unique_character_groups[12];
-            case 1324: return &unique_character_groups[9];
-            case 1325: return &unique_character_groups[12];
-            case 1326: return &unique_character_groups[9];
-            case 1327: return &unique_character_groups[12];
-            case 1329 ... 1366: return &unique_character_groups[9];
-            case 1369: return &unique_character_groups[20];
-            case 1370 ... 1375: return &unique_character_groups[2];
-            case 1376 ... 1416: return &unique_character_groups[12];
-            case 1417: return &unique_character_groups[2];
-            case 1418: return &unique_character_groups[7];
-            case 1421 ... 1422: return &unique_character_groups[13];
-            case 1423: return &unique_character_groups[3];
-            case 1425 ... 1469: return &unique_character_groups[21];
-            case 1470: return &unique_character_groups[7];
-            case 1471: return &unique_character_groups[21];
-            case 1472: return &unique_character_groups[2];
-            case 1473 ... 1474: return &unique_character_groups[21];
-            case 1475: return &unique_character_groups[2];
-            case 1476 ... 1477: return &unique_character_groups[21];
-            case 1478: return &unique_character_groups[2];
-            case 1479: return &unique_character_groups[21];
-            case 1488 ... 1514: return &unique_character_groups[14];
-            case 1519 ... 1522: return &unique_character_groups[14];
-            case 1523 ... 1524: return &unique_character_groups[2];
-            case 1536 ... 1541: return &unique_character_groups[16];
-            case 1542 ... 1544: return &unique_character_groups[6];
-            case 1545 ... 1546: return &unique_character_groups[2];
-            case 1547: return &unique_character_groups[3];
-            case 1548 ... 1549: return &unique_character_groups[2];
-            case 1550 ... 1551: return &unique_character_groups[13];
-            case 1552 ... 1562: return &unique_character_groups[21];
-            case 1563: return &unique_character_groups[2];
-            case 1564: return &unique_character_groups[16];
-            case 1566 ... 1567: return &unique_character_groups[2];
-            case 1568 ... 1599: return &unique_character_groups[14];
-            case 1600: return &unique_character_groups[20];
-            case 1601 ... 1610: return &unique_character_groups[14];
-            case 1611 ... 1631: return &unique_character_groups[21];
-            case 1632 ... 1641: return &unique_character_groups[8];
-            case 1642 ... 1645: return &unique_character_groups[2];
-            case 1646 ... 1647: return &unique_character_groups[14];
-            case 1648: return &unique_character_groups[21];
-            case 1649 ... 1747: return &unique_character_groups[14];
-            case 1748: return &unique_character_groups[2];
-            case 1749: return &unique_character_groups[14];
-            case 1750 ... 1756: return &unique_character_groups[21];
-            case 1757: return &unique_character_groups[16];
-            case 1758: return &unique_character_groups[13];
-            case 1759 ... 1764: return &unique_character_groups[21];
-            case 1765 ... 1766: return &unique_character_groups[20];
-            case 1767 ... 1768: return &unique_character_groups[21];
-            case 1769: return &unique_character_groups[13];
-            case 1770 ... 1773: return &unique_character_groups[21];
-            case 1774 ... 1775: return &unique_character_groups[14];
-            case 1776 ... 1785: return &unique_character_groups[8];
-            case 1786 ... 1788: return &unique_character_groups[14];
-            case 1789 ... 1790: return &unique_character_groups[13];
-            case 1791: return &unique_character_groups[14];
-            case 1792 ... 1805: return &unique_character_groups[2];
-            case 1807: return &unique_character_groups[16];
-            case 1808: return &unique_character_groups[14];
-            case 1809: return &unique_character_groups[21];
-            case 1810 ... 1839: return &unique_character_groups[14];
-            case 1840 ... 1866: return &unique_character_groups[21];
-            case 1869 ... 1957: return &unique_character_groups[14];
-            case 1958 ... 1968: return &unique_character_groups[21];
-            case 1969: return &unique_character_groups[14];
-            case 1984 ... 1993: return &unique_character_groups[8];
-            case 1994 ... 2026: return &unique_character_groups[14];
-            case 2027 ... 2035: return &unique_character_groups[21];
-            case 2036 ... 2037: return &unique_character_groups[20];
-            case 2038: return &unique_character_groups[13];
-            case 2039 ... 2041: return &unique_character_groups[2];
-            case 2042: return &unique_character_groups[20];
-            case 2045: return &unique_character_groups[21];
-            case 2046 ... 2047: return &unique_character_groups[3];
-            case 2048 ... 2069: return &unique_character_groups[14];
-            case 2070 ... 2073: return &unique_character_groups[21];
-            case 2074: return &unique_character_groups[20];
-            case 2075 ... 2083: return &unique_character_groups[21];
-            case 2084: return &unique_character_groups[20];
-            case 2085 ... 2087: return &unique_character_groups[21];
-            case 2088: return &unique_character_groups[20];
-            case 2089 ... 2093: return &unique_character_groups[21];
-            case 2096 ... 2110: return &unique_character_groups[2];
-            case 2112 ... 2136: return &unique_character_groups[14];
-            case 2137 ... 2139: return &unique_character_groups[21];
-            case 2142: return &unique_character_groups[2];
-            case 2144 ... 2154: return &unique_character_groups[14];
-            case 2208 ... 2228: return &unique_character_groups[14];
-            case 2230 ... 2237: return &unique_character_groups[14];
-            case 2259 ... 2273: return &unique_character_groups[21];
-            case 2274: return &unique_character_groups[16];
-            case 2275 ... 2306: return &unique_character_groups[21];
-            case 2307: return &unique_character_groups[23];
-            case 2308 ... 2361: return &unique_character_groups[14];
-            case 2362: return &unique_character_groups[21];
-            case 2363: return &unique_character_groups[23];
-            case 2364: return &unique_character_groups[21];
-            case 2365: return &unique_character_groups[14];
-            case 2366 ... 2368: return &unique_character_groups[23];
-            case 2369 ... 2376: return &unique_character_groups[21];
-            case 2377 ... 2380: return &unique_character_groups[23];
-            case 2381: return &unique_character_groups[21];
-            case 2382 ... 2383: return &unique_character_groups[23];
-            case 2384: return &unique_character_groups[14];
-            case 2385 ... 2391: return &unique_character_groups[21];
-            case 2392 ... 2401: return &unique_character_groups[14];
-            case 2402 ... 2403: return &unique_character_groups[21];
-            case 2404 ... 2405: return &unique_character_groups[2];
-            case 2406 ... 2415: return &unique_character_groups[8];
-            case 2416: return &unique_character_groups[2];
-            case 2417: return &unique_character_groups[20];
-            case 2418 ... 2432: return &unique_character_groups[14];
-            case 2433: return &unique_character_groups[21];
-            case 2434 ... 2435: return &unique_character_groups[23];
-            case 2437 ... 2444: return &unique_character_groups[14];
-            case 2447 ... 2448: return &unique_character_groups[14];
-            case 2451 ... 2472: return &unique_character_groups[14];
-            case 2474 ... 2480: return &unique_character_groups[14];
-            case 2482: return &unique_character_groups[14];
-            case 2486 ... 2489: return &unique_character_groups[14];
-            case 2492: return &unique_character_groups[21];
-            case 2493: return &unique_character_groups[14];
-            case 2494 ... 2496: return &unique_character_groups[23];
-            case 2497 ... 2500: return &unique_character_groups[21];
-            case 2503 ... 2504: return &unique_character_groups[23];
-            case 2507 ... 2508: return &unique_character_groups[23];
-            case 2509: return &unique_character_groups[21];
-            case 2510: return &unique_character_groups[14];
-            case 2519: return &unique_character_groups[23];
-            case 2524 ... 2525: return &unique_character_groups[14];
-            case 2527 ... 2529: return &unique_character_groups[14];
-            case 2530 ... 2531: return &unique_character_groups[21];
-            case 2534 ... 2543: return &unique_character_groups[8];
-            case 2544 ... 2545: return &unique_character_groups[14];
-            case 2546 ... 2547: return &unique_character_groups[3];
-            case 2548 ... 2553: return &unique_character_groups[17];
-            case 2554: return &unique_character_groups[13];
-            case 2555: return &unique_character_groups[3];
-            case 2556: return &unique_character_groups[14];
-            case 2557: return &unique_character_groups[2];
-            case 2558: return &unique_character_groups[21];
-            case 2561 ... 2562: return &unique_character_groups[21];
-            case 2563: return &unique_character_groups[23];
-            case 2565 ... 2570: return &unique_character_groups[14];
-            case 2575 ... 2576: return &unique_character_groups[14];
-            case 2579 ... 2600: return &unique_character_groups[14];
-            case 2602 ... 2608: return &unique_character_groups[14];
-            case 2610 ... 2611: return &unique_character_groups[14];
-            case 2613 ... 2614: return &unique_character_groups[14];
-            case 2616 ... 2617: return &unique_character_groups[14];
-            case 2620: return &unique_character_groups[21];
-            case 2622 ... 2624: return &unique_character_groups[23];
-            case 2625 ... 2626: return &unique_character_groups[21];
-            case 2631 ... 2632: return &unique_character_groups[21];
-            case 2635 ... 2637: return &unique_character_groups[21];
-            case 2641: return &unique_character_groups[21];
-            case 2649 ... 2652: return &unique_character_groups[14];
-            case 2654: return &unique_character_groups[14];
-            case 2662 ... 2671: return &unique_character_groups[8];
-            case 2672 ... 2673: return &unique_character_groups[21];
-            case 2674 ... 2676: return &unique_character_groups[14];
-            case 2677: return &unique_character_groups[21];
-            case 2678: return &unique_character_groups[2];
-            case 2689 ... 2690: return &unique_character_groups[21];
-            case 2691: return &unique_character_groups[23];
-            case 2693 ... 2701: return &unique_character_groups[14];
-            case 2703 ... 2705: return &unique_character_groups[14];
-            case 2707 ... 2728: return &unique_character_groups[14];
-            case 2730 ... 2736: return &unique_character_groups[14];
-            case 2738 ... 2739: return &unique_character_groups[14];
-            case 2741 ... 2745: return &unique_character_groups[14];
-            case 2748: return &unique_character_groups[21];
-            case 2749: return &unique_character_groups[14];
-            case 2750 ... 2752: return &unique_character_groups[23];
-            case 2753 ... 2757: return &unique_character_groups[21];
-            case 2759 ... 2760: return &unique_character_groups[21];
-            case 2761: return &unique_character_groups[23];
-            case 2763 ... 2764: return &unique_character_groups[23];
-            case 2765: return &unique_character_groups[21];
-            case 2768: return &unique_character_groups[14];
-            case 2784 ... 2785: return &unique_character_groups[14];
-            case 2786 ... 2787: return &unique_character_groups[21];
-            case 2790 ... 2799: return &unique_character_groups[8];
-            case 2800: return &unique_character_groups[2];
-            case 2801: return &unique_character_groups[3];
-            case 2809: return &unique_character_groups[14];
-            case 2810 ... 2815: return &unique_character_groups[21];
-            case 2817: return &unique_character_groups[21];
-            case 2818 ... 2819: return &unique_character_groups[23];
-            case 2821 ... 2828: return &unique_character_groups[14];
-            case 2831 ... 2832: return &unique_character_groups[14];
-            case 2835 ... 2856: return &unique_character_groups[14];
-            case 2858 ... 2864: return &unique_character_groups[14];
-            case 2866 ... 2867: return &unique_character_groups[14];
-            case 2869 ... 2873: return &unique_character_groups[14];
-            case 2876: return &unique_character_groups[21];
-            case 2877: return &unique_character_groups[14];
-            case 2878: return &unique_character_groups[23];
-            case 2879: return &unique_character_groups[21];
-            case 2880: return &unique_character_groups[23];
-            case 2881 ... 2884: return &unique_character_groups[21];
-            case 2887 ... 2888: return &unique_character_groups[23];
-            case 2891 ... 2892: return &unique_character_groups[23];
-            case 2893: return &unique_character_groups[21];
-            case 2902: return &unique_character_groups[21];
-            case 2903: return &unique_character_groups[23];
-            case 2908 ... 2909: return &unique_character_groups[14];
-            case 2911 ... 2913: return &unique_character_groups[14];
-            case 2914 ... 2915: return &unique_character_groups[21];
-            case 2918 ... 2927: return &unique_character_groups[8];
-            case 2928: return &unique_character_groups[13];
-            case 2929: return &unique_character_groups[14];
-            case 2930 ... 2935: return &unique_character_groups[17];
-            case 2946: return &unique_character_groups[21];
-            case 2947: return &unique_character_groups[14];
-            case 2949 ... 2954: return &unique_character_groups[14];
-            case 2958 ... 2960: return &unique_character_groups[14];
-            case 2962 ... 2965: return &unique_character_groups[14];
-            case 2969 ... 2970: return &unique_character_groups[14];
-            case 2972: return &unique_character_groups[14];
-            case 2974 ... 2975: return &unique_character_groups[14];
-            case 2979 ... 2980: return &unique_character_groups[14];
-            case 2984 ... 2986: return &unique_character_groups[14];
-            case 2990 ... 3001: return &unique_character_groups[14];
-            case 3006 ... 3007: return &unique_character_groups[23];
-            case 3008: return &unique_character_groups[21];
-            case 3009 ... 3010: return &unique_character_groups[23];
-            case 3014 ... 3016: return &unique_character_groups[23];
-            case 3018 ... 3020: return &unique_character_groups[23];
-            case 3021: return &unique_character_groups[21];
-            case 3024: return &unique_character_groups[14];
-            case 3031: return &unique_character_groups[23];
-            case 3046 ... 3055: return &unique_character_groups[8];
-            case 3056 ... 3058: return &unique_character_groups[17];
-            case 3059 ... 3064: return &unique_character_groups[13];
-            case 3065: return &unique_character_groups[3];
-            case 3066: return &unique_character_groups[13];
-            case 3072: return &unique_character_groups[21];
-            case 3073 ... 3075: return &unique_character_groups[23];
-            case 3076: return &unique_character_groups[21];
-            case 3077 ... 3084: return &unique_character_groups[14];
-            case 3086 ... 3088: return &unique_character_groups[14];
-            case 3090 ... 3112: return &unique_character_groups[14];
-            case 3114 ... 3129: return &unique_character_groups[14];
-            case 3133: return &unique_character_groups[14];
-            case 3134 ... 3136: return &unique_character_groups[21];
-            case 3137 ... 3140: return &unique_character_groups[23];
-            case 3142 ... 3144: return &unique_character_groups[21];
-            case 3146 ... 3149: return &unique_character_groups[21];
-            case 3157 ... 3158: return &unique_character_groups[21];
-            case 3160 ... 3162: return &unique_character_groups[14];
-            case 3168 ... 3169: return &unique_character_groups[14];
-            case 3170 ... 3171: return &unique_character_groups[21];
-            case 3174 ... 3183: return &unique_character_groups[8];
-            case 3192 ... 3198: return &unique_character_groups[17];
-            case 3199: return &unique_character_groups[13];
-            case 3200: return &unique_character_groups[14];
-            case 3201: return &unique_character_groups[21];
-            case 3202 ... 3203: return &unique_character_groups[23];
-            case 3204: return &unique_character_groups[2];
-            case 3205 ... 3212: return &unique_character_groups[14];
-            case 3214 ... 3216: return &unique_character_groups[14];
-            case 3218 ... 3240: return &unique_character_groups[14];
-            case 3242 ... 3251: return &unique_character_groups[14];
-            case 3253 ... 3257: return &unique_character_groups[14];
-            case 3260: return &unique_character_groups[21];
-            case 3261: return &unique_character_groups[14];
-            case 3262: return &unique_character_groups[23];
-            case 3263: return &unique_character_groups[21];
-            case 3264 ... 3268: return &unique_character_groups[23];
-            case 3270: return &unique_character_groups[21];
-            case 3271 ... 3272: return &unique_character_groups[23];
-            case 3274 ... 3275: return &unique_character_groups[23];
-            case 3276 ... 3277: return &unique_character_groups[21];
-            case 3285 ... 3286: return &unique_character_groups[23];
-            case 3294: return &unique_character_groups[14];
-            case 3296 ... 3297: return &unique_character_groups[14];
-            case 3298 ... 3299: return &unique_character_groups[21];
-            case 3302 ... 3311: return &unique_character_groups[8];
-            case 3313 ... 3314: return &unique_character_groups[14];
-            case 3328 ... 3329: return &unique_character_groups[21];
-            case 3330 ... 3331: return &unique_character_groups[23];
-            case 3333 ... 3340: return &unique_character_groups[14];
-            case 3342 ... 3344: return &unique_character_groups[14];
-            case 3346 ... 3386: return &unique_character_groups[14];
-            case 3387 ... 3388: return &unique_character_groups[21];
-            case 3389: return &unique_character_groups[14];
-            case 3390 ... 3392: return &unique_character_groups[23];
-            case 3393 ... 3396: return &unique_character_groups[21];
-            case 3398 ... 3400: return &unique_character_groups[23];
-            case 3402 ... 3404: return &unique_character_groups[23];
-            case 3405: return &unique_character_groups[21];
-            case 3406: return &unique_character_groups[14];
-            case 3407: return &unique_character_groups[13];
-            case 3412 ... 3414: return &unique_character_groups[14];
-            case 3415: return &unique_character_groups[23];
-            case 3416 ... 3422: return &unique_character_groups[17];
-            case 3423 ... 3425: return &unique_character_groups[14];
-            case 3426 ... 3427: return &unique_character_groups[21];
-            case 3430 ... 3439: return &unique_character_groups[8];
-            case 3440 ... 3448: return &unique_character_groups[17];
-            case 3449: return &unique_character_groups[13];
-            case 3450 ... 3455: return &unique_character_groups[14];
-            case 3458 ... 3459: return &unique_character_groups[23];
-            case 3461 ... 3478: return &unique_character_groups[14];
-            case 3482 ... 3505: return &unique_character_groups[14];
-            case 3507 ... 3515: return &unique_character_groups[14];
-            case 3517: return &unique_character_groups[14];
-            case 3520 ... 3526: return &unique_character_groups[14];
-            case 3530: return &unique_character_groups[21];
-            case 3535 ... 3537: return &unique_character_groups[23];
-            case 3538 ... 3540: return &unique_character_groups[21];
-            case 3542: return &unique_character_groups[21];
-            case 3544 ... 3551: return &unique_character_groups[23];
-            case 3558 ... 3567: return &unique_character_groups[8];
-            case 3570 ... 3571: return &unique_character_groups[23];
-            case 3572: return &unique_character_groups[2];
-            case 3585 ... 3632: return &unique_character_groups[14];
-            case 3633: return &unique_character_groups[21];
-            case 3634 ... 3635: return &unique_character_groups[14];
-            case 3636 ... 3642: return &unique_character_groups[21];
-            case 3647: return &unique_character_groups[3];
-            case 3648 ... 3653: return &unique_character_groups[14];
-            case 3654: return &unique_character_groups[20];
-            case 3655 ... 3662: return &unique_character_groups[21];
-            case 3663: return &unique_character_groups[2];
-            case 3664 ... 3673: return &unique_character_groups[8];
-            case 3674 ... 3675: return &unique_character_groups[2];
-            case 3713 ... 3714: return &unique_character_groups[14];
-            case 3716: return &unique_character_groups[14];
-            case 3719 ... 3720: return &unique_character_groups[14];
-            case 3722: return &unique_character_groups[14];
-            case 3725: return &unique_character_groups[14];
-            case 3732 ... 3735: return &unique_character_groups[14];
-            case 3737 ... 3743: return &unique_character_groups[14];
-            case 3745 ... 3747: return &unique_character_groups[14];
-            case 3749: return &unique_character_groups[14];
-            case 3751: return &unique_character_groups[14];
-            case 3754 ... 3755: return &unique_character_groups[14];
-            case 3757 ... 3760: return &unique_character_groups[14];
-            case 3761: return &unique_character_groups[21];
-            case 3762 ... 3763: return &unique_character_groups[14];
-            case 3764 ... 3769: return &unique_character_groups[21];
-            case 3771 ... 3772: return &unique_character_groups[21];
-            case 3773: return &unique_character_groups[14];
-            case 3776 ... 3780: return &unique_character_groups[14];
-            case 3782: return &unique_character_groups[20];
-            case 3784 ... 3789: return &unique_character_groups[21];
-            case 3792 ... 3801: return &unique_character_groups[8];
-            case 3804 ... 3807: return &unique_character_groups[14];
-            case 3840: return &unique_character_groups[14];
-            case 3841 ... 3843: return &unique_character_groups[13];
-            case 3844 ... 3858: return &unique_character_groups[2];
-            case 3859: return &unique_character_groups[13];
-            case 3860: return &unique_character_groups[2];
-            case 3861 ... 3863: return &unique_character_groups[13];
-            case 3864 ... 3865: return &unique_character_groups[21];
-            case 3866 ... 3871: return &unique_character_groups[13];
-            case 3872 ... 3881: return &unique_character_groups[8];
-            case 3882 ... 3891: return &unique_character_groups[17];
-            case 3892: return &unique_character_groups[13];
-            case 3893: return &unique_character_groups[21];
-            case 3894: return &unique_character_groups[13];
-            case 3895: return &unique_character_groups[21];
-            case 3896: return &unique_character_groups[13];
-            case 3897: return &unique_character_groups[21];
-            case 3898: return &unique_character_groups[4];
-            case 3899: return &unique_character_groups[5];
-            case 3900: return &unique_character_groups[4];
-            case 3901: return &unique_character_groups[5];
-            case 3902 ... 3903: return &unique_character_groups[23];
-            case 3904 ... 3911: return &unique_character_groups[14];
-            case 3913 ... 3948: return &unique_character_groups[14];
-            case 3953 ... 3966: return &unique_character_groups[21];
-            case 3967: return &unique_character_groups[23];
-            case 3968 ... 3972: return &unique_character_groups[21];
-            case 3973: return &unique_character_groups[2];
-            case 3974 ... 3975: return &unique_character_groups[21];
-            case 3976 ... 3980: return &unique_character_groups[14];
-            case 3981 ... 3991: return &unique_character_groups[21];
-            case 3993 ... 4028: return &unique_character_groups[21];
-            case 4030 ... 4037: return &unique_character_groups[13];
-            case 4038: return &unique_character_groups[21];
-            case 4039 ... 4044: return &unique_character_groups[13];
-            case 4046 ... 4047: return &unique_character_groups[13];
-            case 4048 ... 4052: return &unique_character_groups[2];
-            case 4053 ... 4056: return &unique_character_groups[13];
-            case 4057 ... 4058: return &unique_character_groups[2];
-            case 4096 ... 4138: return &unique_character_groups[14];
-            case 4139 ... 4140: return &unique_character_groups[23];
-            case 4141 ... 4144: return &unique_character_groups[21];
-            case 4145: return &unique_character_groups[23];
-            case 4146 ... 4151: return &unique_character_groups[21];
-            case 4152: return &unique_character_groups[23];
-            case 4153 ... 4154: return &unique_character_groups[21];
-            case 4155 ... 4156: return &unique_character_groups[23];
-            case 4157 ... 4158: return &unique_character_groups[21];
-            case 4159: return &unique_character_groups[14];
-            case 4160 ... 4169: return &unique_character_groups[8];
-            case 4170 ... 4175: return &unique_character_groups[2];
-            case 4176 ... 4181: return &unique_character_groups[14];
-            case 4182 ... 4183: return &unique_character_groups[23];
-            case 4184 ... 4185: return &unique_character_groups[21];
-            case 4186 ... 4189: return &unique_character_groups[14];
-            case 4190 ... 4192: return &unique_character_groups[21];
-            case 4193: return &unique_character_groups[14];
-            case 4194 ... 4196: return &unique_character_groups[23];
-            case 4197 ... 4198: return &unique_character_groups[14];
-            case 4199 ... 4205: return &unique_character_groups[23];
-            case 4206 ... 4208: return &unique_character_groups[14];
-            case 4209 ... 4212: return &unique_character_groups[21];
-            case 4213 ... 4225: return &unique_character_groups[14];
-            case 4226: return &unique_character_groups[21];
-            case 4227 ... 4228: return &unique_character_groups[23];
-            case 4229 ... 4230: return &unique_character_groups[21];
-            case 4231 ... 4236: return &unique_character_groups[23];
-            case 4237: return &unique_character_groups[21];
-            case 4238: return &unique_character_groups[14];
-            case 4239: return &unique_character_groups[23];
-            case 4240 ... 4249: return &unique_character_groups[8];
-            case 4250 ... 4252: return &unique_character_groups[23];
-            case 4253: return &unique_character_groups[21];
-            case 4254 ... 4255: return &unique_character_groups[13];
-            case 4256 ... 4293: return &unique_character_groups[9];
-            case 4295: return &unique_character_groups[9];
-            case 4301: return &unique_character_groups[9];
-            case 4304 ... 4346: return &unique_character_groups[12];
-            case 4347: return &unique_character_groups[2];
-            case 4348: return &unique_character_groups[20];
-            case 4349 ... 4351: return &unique_character_groups[12];
-            case 4352 ... 4680: return &unique_character_groups[14];
-            case 4682 ... 4685: return &unique_character_groups[14];
-            case 4688 ... 4694: return &unique_character_groups[14];
-            case 4696: return &unique_character_groups[14];
-            case 4698 ... 4701: return &unique_character_groups[14];
-            case 4704 ... 4744: return &unique_character_groups[14];
-            case 4746 ... 4749: return &unique_character_groups[14];
-            case 4752 ... 4784: return &unique_character_groups[14];
-            case 4786 ... 4789: return &unique_character_groups[14];
-            case 4792 ... 4798: return &unique_character_groups[14];
-            case 4800: return &unique_character_groups[14];
-            case 4802 ... 4805: return &unique_character_groups[14];
-            case 4808 ... 4822: return &unique_character_groups[14];
-            case 4824 ... 4880: return &unique_character_groups[14];
-            case 4882 ... 4885: return &unique_character_groups[14];
-            case 4888 ... 4954: return &unique_character_groups[14];
-            case 4957 ... 4959: return &unique_character_groups[21];
-            case 4960 ... 4968: return &unique_character_groups[2];
-            case 4969 ... 4988: return &unique_character_groups[17];
-            case 4992 ... 5007: return &unique_character_groups[14];
-            case 5008 ... 5017: return &unique_character_groups[13];
-            case 5024 ... 5109: return &unique_character_groups[9];
-            case 5112 ... 5117: return &unique_character_groups[12];
-            case 5120: return &unique_character_groups[7];
-            case 5121 ... 5740: return &unique_character_groups[14];
-            case 5741 ... 5742: return &unique_character_groups[2];
-            case 5743 ... 5759: return &unique_character_groups[14];
-            case 5760: return &unique_character_groups[1];
-            case 5761 ... 5786: return &unique_character_groups[14];
-            case 5787: return &unique_character_groups[4];
-            case 5788: return &unique_character_groups[5];
-            case 5792 ... 5866: return &unique_character_groups[14];
-            case 5867 ... 5869: return &unique_character_groups[2];
-            case 5870 ... 5872: return &unique_character_groups[24];
-            case 5873 ... 5880: return &unique_character_groups[14];
-            case 5888 ... 5900: return &unique_character_groups[14];
-            case 5902 ... 5905: return &unique_character_groups[14];
-            case 5906 ... 5908: return &unique_character_groups[21];
-            case 5920 ... 5937: return &unique_character_groups[14];
-            case 5938 ... 5940: return &unique_character_groups[21];
-            case 5941 ... 5942: return &unique_character_groups[2];
-            case 5952 ... 5969: return &unique_character_groups[14];
-            case 5970 ... 5971: return &unique_character_groups[21];
-            case 5984 ... 5996: return &unique_character_groups[14];
-            case 5998 ... 6000: return &unique_character_groups[14];
-            case 6002 ... 6003: return &unique_character_groups[21];
-            case 6016 ... 6067: return &unique_character_groups[14];
-            case 6068 ... 6069: return &unique_character_groups[21];
-            case 6070: return &unique_character_groups[23];
-            case 6071 ... 6077: return &unique_character_groups[21];
-            case 6078 ... 6085: return &unique_character_groups[23];
-            case 6086: return &unique_character_groups[21];
-            case 6087 ... 6088: return &unique_character_groups[23];
-            case 6089 ... 6099: return &unique_character_groups[21];
-            case 6100 ... 6102: return &unique_character_groups[2];
-            case 6103: return &unique_character_groups[20];
-            case 6104 ... 6106: return &unique_character_groups[2];
-            case 6107: return &unique_character_groups[3];
-            case 6108: return &unique_character_groups[14];
-            case 6109: return &unique_character_groups[21];
-            case 6112 ... 6121: return &unique_character_groups[8];
-            case 6128 ... 6137: return &unique_character_groups[17];
-            case 6144 ... 6149: return &unique_character_groups[2];
-            case 6150: return &unique_character_groups[7];
-            case 6151 ... 6154: return &unique_character_groups[2];
-            case 6155 ... 6157: return &unique_character_groups[21];
-            case 6158: return &unique_character_groups[16];
-            case 6160 ... 6169: return &unique_character_groups[8];
-            case 6176 ... 6210: return &unique_character_groups[14];
-            case 6211: return &unique_character_groups[20];
-            case 6212 ... 6264: return &unique_character_groups[14];
-            case 6272 ... 6276: return &unique_character_groups[14];
-            case 6277 ... 6278: return &unique_character_groups[21];
-            case 6279 ... 6312: return &unique_character_groups[14];
-            case 6313: return &unique_character_groups[21];
-            case 6314: return &unique_character_groups[14];
-            case 6320 ... 6389: return &unique_character_groups[14];
-            case 6400 ... 6430: return &unique_character_groups[14];
-            case 6432 ... 6434: return &unique_character_groups[21];
-            case 6435 ... 6438: return &unique_character_groups[23];
-            case 6439 ... 6440: return &unique_character_groups[21];
-            case 6441 ... 6443: return &unique_character_groups[23];
-            case 6448 ... 6449: return &unique_character_groups[23];
-            case 6450: return &unique_character_groups[21];
-            case 6451 ... 6456: return &unique_character_groups[23];
-            case 6457 ... 6459: return &unique_character_groups[21];
-            case 6464: return &unique_character_groups[13];
-            case 6468 ... 6469: return &unique_character_groups[2];
-            case 6470 ... 6479: return &unique_character_groups[8];
-            case 6480 ... 6509: return &unique_character_groups[14];
-            case 6512 ... 6516: return &unique_character_groups[14];
-            case 6528 ... 6571: return &unique_character_groups[14];
-            case 6576 ... 6601: return &unique_character_groups[14];
-            case 6608 ... 6617: return &unique_character_groups[8];
-            case 6618: return &unique_character_groups[17];
-            case 6622 ... 6655: return &unique_character_groups[13];
-            case 6656 ... 6678: return &unique_character_groups[14];
-            case 6679 ... 6680: return &unique_character_groups[21];
-            case 6681 ... 6682: return &unique_character_groups[23];
-            case 6683: return &unique_character_groups[21];
-            case 6686 ... 6687: return &unique_character_groups[2];
-            case 6688 ... 6740: return &unique_character_groups[14];
-            case 6741: return &unique_character_groups[23];
-            case 6742: return &unique_character_groups[21];
-            case 6743: return &unique_character_groups[23];
-            case 6744 ... 6750: return &unique_character_groups[21];
-            case 6752: return &unique_character_groups[21];
-            case 6753: return &unique_character_groups[23];
-            case 6754: return &unique_character_groups[21];
-            case 6755 ... 6756: return &unique_character_groups[23];
-            case 6757 ... 6764: return &unique_character_groups[21];
-            case 6765 ... 6770: return &unique_character_groups[23];
-            case 6771 ... 6780: return &unique_character_groups[21];
-            case 6783: return &unique_character_groups[21];
-            case 6784 ... 6793: return &unique_character_groups[8];
-            case 6800 ... 6809: return &unique_character_groups[8];
-            case 6816 ... 6822: return &unique_character_groups[2];
-            case 6823: return &unique_character_groups[20];
-            case 6824 ... 6829: return &unique_character_groups[2];
-            case 6832 ... 6845: return &unique_character_groups[21];
-            case 6846: return &unique_character_groups[22];
-            case 6912 ... 6915: return &unique_character_groups[21];
-            case 6916: return &unique_character_groups[23];
-            case 6917 ... 6963: return &unique_character_groups[14];
-            case 6964: return &unique_character_groups[21];
-            case 6965: return &unique_character_groups[23];
-            case 6966 ... 6970: return &unique_character_groups[21];
-            case 6971: return &unique_character_groups[23];
-            case 6972: return &unique_character_groups[21];
-            case 6973 ... 6977: return &unique_character_groups[23];
-            case 6978: return &unique_character_groups[21];
-            case 6979 ... 6980: return &unique_character_groups[23];
-            case 6981 ... 6987: return &unique_character_groups[14];
-            case 6992 ... 7001: return &unique_character_groups[8];
-            case 7002 ... 7008: return &unique_character_groups[2];
-            case 7009 ... 7018: return &unique_character_groups[13];
-            case 7019 ... 7027: return &unique_character_groups[21];
-            case 7028 ... 7036: return &unique_character_groups[13];
-            case 7040 ... 7041: return &unique_character_groups[21];
-            case 7042: return &unique_character_groups[23];
-            case 7043 ... 7072: return &unique_character_groups[14];
-            case 7073: return &unique_character_groups[23];
-            case 7074 ... 7077: return &unique_character_groups[21];
-            case 7078 ... 7079: return &unique_character_groups[23];
-            case 7080 ... 7081: return &unique_character_groups[21];
-            case 7082: return &unique_character_groups[23];
-            case 7083 ... 7085: return &unique_character_groups[21];
-            case 7086 ... 7087: return &unique_character_groups[14];
-            case 7088 ... 7097: return &unique_character_groups[8];
-            case 7098 ... 7141: return &unique_character_groups[14];
-            case 7142: return &unique_character_groups[21];
-            case 7143: return &unique_character_groups[23];
-            case 7144 ... 7145: return &unique_character_groups[21];
-            case 7146 ... 7148: return &unique_character_groups[23];
-            case 7149: return &unique_character_groups[21];
-            case 7150: return &unique_character_groups[23];
-            case 7151 ... 7153: return &unique_character_groups[21];
-            case 7154 ... 7155: return &unique_character_groups[23];
-            case 7164 ... 7167: return &unique_character_groups[2];
-            case 7168 ... 7203: return &unique_character_groups[14];
-            case 7204 ... 7211: return &unique_character_groups[23];
-            case 7212 ... 7219: return &unique_character_groups[21];
-            case 7220 ... 7221: return &unique_character_groups[23];
-            case 7222 ... 7223: return &unique_character_groups[21];
-            case 7227 ... 7231: return &unique_character_groups[2];
-            case 7232 ... 7241: return &unique_character_groups[8];
-            case 7245 ... 7247: return &unique_character_groups[14];
-            case 7248 ... 7257: return &unique_character_groups[8];
-            case 7258 ... 7287: return &unique_character_groups[14];
-            case 7288 ... 7293: return &unique_character_groups[20];
-            case 7294 ... 7295: return &unique_character_groups[2];
-            case 7296 ... 7304: return &unique_character_groups[12];
-            case 7312 ... 7354: return &unique_character_groups[9];
-            case 7357 ... 7359: return &unique_character_groups[9];
-            case 7360 ... 7367: return &unique_character_groups[2];
-            case 7376 ... 7378: return &unique_character_groups[21];
-            case 7379: return &unique_character_groups[2];
-            case 7380 ... 7392: return &unique_character_groups[21];
-            case 7393: return &unique_character_groups[23];
-            case 7394 ... 7400: return &unique_character_groups[21];
-            case 7401 ... 7404: return &unique_character_groups[14];
-            case 7405: return &unique_character_groups[21];
-            case 7406 ... 7409: return &unique_character_groups[14];
-            case 7410 ... 7411: return &unique_character_groups[23];
-            case 7412: return &unique_character_groups[21];
-            case 7413 ... 7414: return &unique_character_groups[14];
-            case 7415: return &unique_character_groups[23];
-            case 7416 ... 7417: return &unique_character_groups[21];
-            case 7424 ... 7467: return &unique_character_groups[12];
-            case 7468 ... 7530: return &unique_character_groups[20];
-            case 7531 ... 7543: return &unique_character_groups[12];
-            case 7544: return &unique_character_groups[20];
-            case 7545 ... 7578: return &unique_character_groups[12];
-            case 7579 ... 7615: return &unique_character_groups[20];
-            case 7616 ... 7673: return &unique_character_groups[21];
-            case 7675 ... 7679: return &unique_character_groups[21];
-            case 7680: return &unique_character_groups[9];
-            case 7681: return &unique_character_groups[12];
-            case 7682: return &unique_character_groups[9];
-            case 7683: return &unique_character_groups[12];
-            case 7684: return &unique_character_groups[9];
-            case 7685: return &unique_character_groups[12];
-            case 7686: return &unique_character_groups[9];
-            case 7687: return &unique_character_groups[12];
-            case 7688: return &unique_character_groups[9];
-            case 7689: return &unique_character_groups[12];
-            case 7690: return &unique_character_groups[9];
-            case 7691: return &unique_character_groups[12];
-            case 7692: return &unique_character_groups[9];
-            case 7693: return &unique_character_groups[12];
-            case 7694: return &unique_character_groups[9];
-            case 7695: return &unique_character_groups[12];
-            case 7696: return &unique_character_groups[9];
-            case 7697: return &unique_character_groups[12];
-            case 7698: return &unique_character_groups[9];
-            case 7699: return &unique_character_groups[12];
-            case 7700: return &unique_character_groups[9];
-            case 7701: return &unique_character_groups[12];
-            case 7702: return &unique_character_groups[9];
-            case 7703: return &unique_character_groups[12];
-            case 7704: return &unique_character_groups[9];
-            case 7705: return &unique_character_groups[12];
-            case 7706: return &unique_character_groups[9];
-            case 7707: return &unique_character_groups[12];
-            case 7708: return &unique_character_groups[9];
-            case 7709: return &unique_character_groups[12];
-            case 7710: return &unique_character_groups[9];
-            case 7711: return &unique_character_groups[12];
-            case 7712: return &unique_character_groups[9];
-            case 7713: return &unique_character_groups[12];
-            case 7714: return &unique_character_groups[9];
-            case 7715: return &unique_character_groups[12];
-            case 7716: return &unique_character_groups[9];
-            case 7717: return &unique_character_groups[12];
-            case 7718: return &unique_character_groups[9];
-            case 7719: return &unique_character_groups[12];
-            case 7720: return &unique_character_groups[9];
-            case 7721: return &unique_character_groups[12];
-            case 7722: return &unique_character_groups[9];
-            case 7723: return &unique_character_groups[12];
-            case 7724: return &unique_character_groups[9];
-            case 7725: return &unique_character_groups[12];
-            case 7726: return &unique_character_groups[9];
-            case 7727: return &unique_character_groups[12];
-            case 7728: return &unique_character_groups[9];
-            case 7729: return &unique_character_groups[12];
-            case 7730: return &unique_character_groups[9];
-            case 7731: return &unique_character_groups[12];
-            case 7732: return &unique_character_groups[9];
-            case 7733: return &unique_character_groups[12];
-            case 7734: return &unique_character_groups[9];
-            case 7735: return &unique_character_groups[12];
-            case 7736: return &unique_character_groups[9];
-            case 7737: return &unique_character_groups[12];
-            case 7738: return &unique_character_groups[9];
-            case 7739: return &unique_character_groups[12];
-            case 7740: return &unique_character_groups[9];
-            case 7741: return &unique_character_groups[12];
-            case 7742: return &unique_character_groups[9];
-            case 7743: return &unique_character_groups[12];
-            case 7744: return &unique_character_groups[9];
-            case 7745: return &unique_character_groups[12];
-            case 7746: return &unique_character_groups[9];
-            case 7747: return &unique_character_groups[12];
-            case 7748: return &unique_character_groups[9];
-            case 7749: return &unique_character_groups[12];
-            case 7750: return &unique_character_groups[9];
-            case 7751: return &unique_character_groups[12];
-            case 7752: return &unique_character_groups[9];
-            case 7753: return &unique_character_groups[12];
-            case 7754: return &unique_character_groups[9];
-            case 7755: return &unique_character_groups[12];
-            case 7756: return &unique_character_groups[9];
-            case 7757: return &unique_character_groups[12];
-            case 7758: return &unique_character_groups[9];
-            case 7759: return &unique_character_groups[12];
-            case 7760: return &unique_character_groups[9];
-            case 7761: return &unique_character_groups[12];
-            case 7762: return &unique_character_groups[9];
-            case 7763: return &unique_character_groups[12];
-            case 7764: return &unique_character_groups[9];
-            case 7765: return &unique_character_groups[12];
-            case 7766: return &unique_character_groups[9];
-            case 7767: return &unique_character_groups[12];
-            case 7768: return &unique_character_groups[9];
-            case 7769: return &unique_character_groups[12];
-            case 7770: return &unique_character_groups[9];
-            case 7771: return &unique_character_groups[12];
-            case 7772: return &unique_character_groups[9];
-            case 7773: return &unique_character_groups[12];
-            case 7774: return &unique_character_groups[9];
-            case 7775: return &unique_character_groups[12];
-            case 7776: return &unique_character_groups[9];
-            case 7777: return &unique_character_groups[12];
-            case 7778: return &unique_character_groups[9];
-            case 7779: return &unique_character_groups[12];
-            case 7780: return &unique_character_groups[9];
-            case 7781: return &unique_character_groups[12];
-            case 7782: return &unique_character_groups[9];
-            case 7783: return &unique_character_groups[12];
-            case 7784: return &unique_character_groups[9];
-            case 7785: return &unique_character_groups[12];
-            case 7786: return &unique_character_groups[9];
-            case 7787: return &unique_character_groups[12];
-            case 7788: return &unique_character_groups[9];
-            case 7789: return &unique_character_groups[12];
-            case 7790: return &unique_character_groups[9];
-            case 7791: return &unique_character_groups[12];
-            case 7792: return &unique_character_groups[9];
-            case 7793: return &unique_character_groups[12];
-            case 7794: return &unique_character_groups[9];
-            case 7795: return &unique_character_groups[12];
-            case 7796: return &unique_character_groups[9];
-            case 7797: return &unique_character_groups[12];
-            case 7798: return &unique_character_groups[9];
-            case 7799: return &unique_character_groups[12];
-            case 7800: return &unique_character_groups[9];
-            case 7801: return &unique_character_groups[12];
-            case 7802: return &unique_character_groups[9];
-            case 7803: return &unique_character_groups[12];
-            case 7804: return &unique_character_groups[9];
-            case 7805: return &unique_character_groups[12];
-            case 7806: return &unique_character_groups[9];
-            case 7807: return &unique_character_groups[12];
-            case 7808: return &unique_character_groups[9];
-            case 7809: return &unique_character_groups[12];
-            case 7810: return &unique_character_groups[9];
-            case 7811: return &unique_character_groups[12];
-            case 7812: return &unique_character_groups[9];
-            case 7813: return &unique_character_groups[12];
-            case 7814: return &unique_character_groups[9];
-            case 7815: return &unique_character_groups[12];
-            case 7816: return &unique_character_groups[9];
-            case 7817: return &unique_character_groups[12];
-            case 7818: return &unique_character_groups[9];
-            case 7819: return &unique_character_groups[12];
-            case 7820: return &unique_character_groups[9];
-            case 7821: return &unique_character_groups[12];
-            case 7822: return &unique_character_groups[9];
-            case 7823: return &unique_character_groups[12];
-            case 7824: return &unique_character_groups[9];
-            case 7825: return &unique_character_groups[12];
-            case 7826: return &unique_character_groups[9];
-            case 7827: return &unique_character_groups[12];
-            case 7828: return &unique_character_groups[9];
-            case 7829 ... 7837: return &unique_character_groups[12];
-            case 7838: return &unique_character_groups[9];
-            case 7839: return &unique_character_groups[12];
-            case 7840: return &unique_character_groups[9];
-            case 7841: return &unique_character_groups[12];
-            case 7842: return &unique_character_groups[9];
-            case 7843: return &unique_character_groups[12];
-            case 7844: return &unique_character_groups[9];
-            case 7845: return &unique_character_groups[12];
-            case 7846: return &unique_character_groups[9];
-            case 7847: return &unique_character_groups[12];
-            case 7848: return &unique_character_groups[9];
-            case 7849: return &unique_character_groups[12];
-            case 7850: return &unique_character_groups[9];
-            case 7851: return &unique_character_groups[12];
-            case 7852: return &unique_character_groups[9];
-            case 7853: return &unique_character_groups[12];
-            case 7854: return &unique_character_groups[9];
-            case 7855: return &unique_character_groups[12];
-            case 7856: return &unique_character_groups[9];
-            case 7857: return &unique_character_groups[12];
-            case 7858: return &unique_character_groups[9];
-            case 7859: return &unique_character_groups[12];
-            case 7860: return &unique_character_groups[9];
-            case 7861: return &unique_character_groups[12];
-            case 7862: return &unique_character_groups[9];
-            case 7863: return &unique_character_groups[12];
-            case 7864: return &unique_character_groups[9];
-            case 7865: return &unique_character_groups[12];
-            case 7866: return &unique_character_groups[9];
-            case 7867: return &unique_character_groups[12];
-            case 7868: return &unique_character_groups[9];
-            case 7869: return &unique_character_groups[12];
-            case 7870: return &unique_character_groups[9];
-            case 7871: return &unique_character_groups[12];
-            case 7872: return &unique_character_groups[9];
-            case 7873: return &unique_character_groups[12];
-            case 7874: return &unique_character_groups[9];
-            case 7875: return &unique_character_groups[12];
-            case 7876: return &unique_character_groups[9];
-            case 7877: return &unique_character_groups[12];
-            case 7878: return &unique_character_groups[9];
-            case 7879: return &unique_character_groups[12];
-            case 7880: return &unique_character_groups[9];
-            case 7881: return &unique_character_groups[12];
-            case 7882: return &unique_character_groups[9];
-            case 7883: return &unique_character_groups[12];
-            case 7884: return &unique_character_groups[9];
-            case 7885: return &unique_character_groups[12];
-            case 7886: return &unique_character_groups[9];
-            case 7887: return &unique_character_groups[12];
-            case 7888: return &unique_character_groups[9];
-            case 7889: return &unique_character_groups[12];
-            case 7890: return &unique_character_groups[9];
-            case 7891: return &unique_character_groups[12];
-            case 7892: return &unique_character_groups[9];
-            case 7893: return &unique_character_groups[12];
-            case 7894: return &unique_character_groups[9];
-            case 7895: return &unique_character_groups[12];
-            case 7896: return &unique_character_groups[9];
-            case 7897: return &unique_character_groups[12];
-            case 7898: return &unique_character_groups[9];
-            case 7899: return &unique_character_groups[12];
-            case 7900: return &unique_character_groups[9];
-            case 7901: return &unique_character_groups[12];
-            case 7902: return &unique_character_groups[9];
-            case 7903: return &unique_character_groups[12];
-            case 7904: return &unique_character_groups[9];
-            case 7905: return &unique_character_groups[12];
-            case 7906: return &unique_character_groups[9];
-            case 7907: return &unique_character_groups[12];
-            case 7908: return &unique_character_groups[9];
-            case 7909: return &unique_character_groups[12];
-            case 7910: return &unique_character_groups[9];
-            case 7911: return &unique_character_groups[12];
-            case 7912: return &unique_character_groups[9];
-            case 7913: return &unique_character_groups[12];
-            case 7914: return &unique_character_groups[9];
-            case 7915: return &unique_character_groups[12];
-            case 7916: return &unique_character_groups[9];
-            case 7917: return &unique_character_groups[12];
-            case 7918: return &unique_character_groups[9];
-            case 7919: return &unique_character_groups[12];
-            case 7920: return &unique_character_groups[9];
-            case 7921: return &unique_character_groups[12];
-            case 7922: return &unique_character_groups[9];
-            case 7923: return &unique_character_groups[12];
-            case 7924: return &unique_character_groups[9];
-            case 7925: return &unique_character_groups[12];
-            case 7926: return &unique_character_groups[9];
-            case 7927: return &unique_character_groups[12];
-            case 7928: return &unique_character_groups[9];
-            case 7929: return &unique_character_groups[12];
-            case 7930: return &unique_character_groups[9];
-            case 7931: return &unique_character_groups[12];
-            case 7932: return &unique_character_groups[9];
-            case 7933: return &unique_character_groups[12];
-            case 7934: return &unique_character_groups[9];
-            case 7935 ... 7943: return &unique_character_groups[12];
-            case 7944 ... 7951: return &unique_character_groups[9];
-            case 7952 ... 7957: return &unique_character_groups[12];
-            case 7960 ... 7965: return &unique_character_groups[9];
-            case 7968 ... 7975: return &unique_character_groups[12];
-            case 7976 ... 7983: return &unique_character_groups[9];
-            case 7984 ... 7991: return &unique_character_groups[12];
-            case 7992 ... 7999: return &unique_character_groups[9];
-            case 8000 ... 8005: return &unique_character_groups[12];
-            case 8008 ... 8013: return &unique_character_groups[9];
-            case 8016 ... 8023: return &unique_character_groups[12];
-            case 8025: return &unique_character_groups[9];
-            case 8027: return &unique_character_groups[9];
-            case 8029: return &unique_character_groups[9];
-            case 8031: return &unique_character_groups[9];
-            case 8032 ... 8039: return &unique_character_groups[12];
-            case 8040 ... 8047: return &unique_character_groups[9];
-            case 8048 ... 8061: return &unique_character_groups[12];
-            case 8064 ... 8071: return &unique_character_groups[12];
-            case 8072 ... 8079: return &unique_character_groups[19];
-            case 8080 ... 8087: return &unique_character_groups[12];
-            case 8088 ... 8095: return &unique_character_groups[19];
-            case 8096 ... 8103: return &unique_character_groups[12];
-            case 8104 ... 8111: return &unique_character_groups[19];
-            case 8112 ... 8116: return &unique_character_groups[12];
-            case 8118 ... 8119: return &unique_character_groups[12];
-            case 8120 ... 8123: return &unique_character_groups[9];
-            case 8124: return &unique_character_groups[19];
-            case 8125: return &unique_character_groups[10];
-            case 8126: return &unique_character_groups[12];
-            case 8127 ... 8129: return &unique_character_groups[10];
-            case 8130 ... 8132: return &unique_character_groups[12];
-            case 8134 ... 8135: return &unique_character_groups[12];
-            case 8136 ... 8139: return &unique_character_groups[9];
-            case 8140: return &unique_character_groups[19];
-            case 8141 ... 8143: return &unique_character_groups[10];
-            case 8144 ... 8147: return &unique_character_groups[12];
-            case 8150 ... 8151: return &unique_character_groups[12];
-            case 8152 ... 8155: return &unique_character_groups[9];
-            case 8157 ... 8159: return &unique_character_groups[10];
-            case 8160 ... 8167: return &unique_character_groups[12];
-            case 8168 ... 8172: return &unique_character_groups[9];
-            case 8173 ... 8175: return &unique_character_groups[10];
-            case 8178 ... 8180: return &unique_character_groups[12];
-            case 8182 ... 8183: return &unique_character_groups[12];
-            case 8184 ... 8187: return &unique_character_groups[9];
-            case 8188: return &unique_character_groups[19];
-            case 8189 ... 8190: return &unique_character_groups[10];
-            case 8192 ... 8202: return &unique_character_groups[1];
-            case 8203 ... 8207: return &unique_character_groups[16];
-            case 8208 ... 8213: return &unique_character_groups[7];
-            case 8214 ... 8215: return &unique_character_groups[2];
-            case 8216: return &unique_character_groups[15];
-            case 8217: return &unique_character_groups[18];
-            case 8218: return &unique_character_groups[4];
-            case 8219 ... 8220: return &unique_character_groups[15];
-            case 8221: return &unique_character_groups[18];
-            case 8222: return &unique_character_groups[4];
-            case 8223: return &unique_character_groups[15];
-            case 8224 ... 8231: return &unique_character_groups[2];
-            case 8232: return &unique_character_groups[25];
-            case 8233: return &unique_character_groups[26];
-            case 8234 ... 8238: return &unique_character_groups[16];
-            case 8239: return &unique_character_groups[1];
-            case 8240 ... 8248: return &unique_character_groups[2];
-            case 8249: return &unique_character_groups[15];
-            case 8250: return &unique_character_groups[18];
-            case 8251 ... 8254: return &unique_character_groups[2];
-            case 8255 ... 8256: return &unique_character_groups[11];
-            case 8257 ... 8259: return &unique_character_groups[2];
-            case 8260: return &unique_character_groups[6];
-            case 8261: return &unique_character_groups[4];
-            case 8262: return &unique_character_groups[5];
-            case 8263 ... 8273: return &unique_character_groups[2];
-            case 8274: return &unique_character_groups[6];
-            case 8275: return &unique_character_groups[2];
-            case 8276: return &unique_character_groups[11];
-            case 8277 ... 8286: return &unique_character_groups[2];
-            case 8287: return &unique_character_groups[1];
-            case 8288 ... 8292: return &unique_character_groups[16];
-            case 8294 ... 8303: return &unique_character_groups[16];
-            case 8304: return &unique_character_groups[17];
-            case 8305: return &unique_character_groups[20];
-            case 8308 ... 8313: return &unique_character_groups[17];
-            case 8314 ... 8316: return &unique_character_groups[6];
-            case 8317: return &unique_character_groups[4];
-            case 8318: return &unique_character_groups[5];
-            case 8319: return &unique_character_groups[20];
-            case 8320 ... 8329: return &unique_character_groups[17];
-            case 8330 ... 8332: return &unique_character_groups[6];
-            case 8333: return &unique_character_groups[4];
-            case 8334: return &unique_character_groups[5];
-            case 8336 ... 8348: return &unique_character_groups[20];
-            case 8352 ... 8383: return &unique_character_groups[3];
-            case 8400 ... 8412: return &unique_character_groups[21];
-            case 8413 ... 8416: return &unique_character_groups[22];
-            case 8417: return &unique_character_groups[21];
-            case 8418 ... 8420: return &unique_character_groups[22];
-            case 8421 ... 8432: return &unique_character_groups[21];
-            case 8448 ... 8449: return &unique_character_groups[13];
-            case 8450: return &unique_character_groups[9];
-            case 8451 ... 8454: return &unique_character_groups[13];
-            case 8455: return &unique_character_groups[9];
-            case 8456 ... 8457: return &unique_character_groups[13];
-            case 8458: return &unique_character_groups[12];
-            case 8459 ... 8461: return &unique_character_groups[9];
-            case 8462 ... 8463: return &unique_character_groups[12];
-            case 8464 ... 8466: return &unique_character_groups[9];
-            case 8467: return &unique_character_groups[12];
-            case 8468: return &unique_character_groups[13];
-            case 8469: return &unique_character_groups[9];
-            case 8470 ... 8471: return &unique_character_groups[13];
-            case 8472: return &unique_character_groups[6];
-            case 8473 ... 8477: return &unique_character_groups[9];
-            case 8478 ... 8483: return &unique_character_groups[13];
-            case 8484: return &unique_character_groups[9];
-            case 8485: return &unique_character_groups[13];
-            case 8486: return &unique_character_groups[9];
-            case 8487: return &unique_character_groups[13];
-            case 8488: return &unique_character_groups[9];
-            case 8489: return &unique_character_groups[13];
-            case 8490 ... 8493: return &unique_character_groups[9];
-            case 8494: return &unique_character_groups[13];
-            case 8495: return &unique_character_groups[12];
-            case 8496 ... 8499: return &unique_character_groups[9];
-            case 8500: return &unique_character_groups[12];
-            case 8501 ... 8504: return &unique_character_groups[14];
-            case 8505: return &unique_character_groups[12];
-            case 8506 ... 8507: return &unique_character_groups[13];
-            case 8508 ... 8509: return &unique_character_groups[12];
-            case 8510 ... 8511: return &unique_character_groups[9];
-            case 8512 ... 8516: return &unique_character_groups[6];
-            case 8517: return &unique_character_groups[9];
-            case 8518 ... 8521: return &unique_character_groups[12];
-            case 8522: return &unique_character_groups[13];
-            case 8523: return &unique_character_groups[6];
-            case 8524 ... 8525: return &unique_character_groups[13];
-            case 8526: return &unique_character_groups[12];
-            case 8527: return &unique_character_groups[13];
-            case 8528 ... 8543: return &unique_character_groups[17];
-            case 8544 ... 8578: return &unique_character_groups[24];
-            case 8579: return &unique_character_groups[9];
-            case 8580: return &unique_character_groups[12];
-            case 8581 ... 8584: return &unique_character_groups[24];
-            case 8585: return &unique_character_groups[17];
-            case 8586 ... 8587: return &unique_character_groups[13];
-            case 8592 ... 8596: return &unique_character_groups[6];
-            case 8597 ... 8601: return &unique_character_groups[13];
-            case 8602 ... 8603: return &unique_character_groups[6];
-            case 8604 ... 8607: return &unique_character_groups[13];
-            case 8608: return &unique_character_groups[6];
-            case 8609 ... 8610: return &unique_character_groups[13];
-            case 8611: return &unique_character_groups[6];
-            case 8612 ... 8613: return &unique_character_groups[13];
-            case 8614: return &unique_character_groups[6];
-            case 8615 ... 8621: return &unique_character_groups[13];
-            case 8622: return &unique_character_groups[6];
-            case 8623 ... 8653: return &unique_character_groups[13];
-            case 8654 ... 8655: return &unique_character_groups[6];
-            case 8656 ... 8657: return &unique_character_groups[13];
-            case 8658: return &unique_character_groups[6];
-            case 8659: return &unique_character_groups[13];
-            case 8660: return &unique_character_groups[6];
-            case 8661 ... 8691: return &unique_character_groups[13];
-            case 8692 ... 8959: return &unique_character_groups[6];
-            case 8960 ... 8967: return &unique_character_groups[13];
-            case 8968: return &unique_character_groups[4];
-            case 8969: return &unique_character_groups[5];
-            case 8970: return &unique_character_groups[4];
-            case 8971: return &unique_character_groups[5];
-            case 8972 ... 8991: return &unique_character_groups[13];
-            case 8992 ... 8993: return &unique_character_groups[6];
-            case 8994 ... 9000: return &unique_character_groups[13];
-            case 9001: return &unique_character_groups[4];
-            case 9002: return &unique_character_groups[5];
-            case 9003 ... 9083: return &unique_character_groups[13];
-            case 9084: return &unique_character_groups[6];
-            case 9085 ... 9114: return &unique_character_groups[13];
-            case 9115 ... 9139: return &unique_character_groups[6];
-            case 9140 ... 9179: return &unique_character_groups[13];
-            case 9180 ... 9185: return &unique_character_groups[6];
-            case 9186 ... 9254: return &unique_character_groups[13];
-            case 9280 ... 9290: return &unique_character_groups[13];
-            case 9312 ... 9371: return &unique_character_groups[17];
-            case 9372 ... 9449: return &unique_character_groups[13];
-            case 9450 ... 9471: return &unique_character_groups[17];
-            case 9472 ... 9654: return &unique_character_groups[13];
-            case 9655: return &unique_character_groups[6];
-            case 9656 ... 9664: return &unique_character_groups[13];
-            case 9665: return &unique_character_groups[6];
-            case 9666 ... 9719: return &unique_character_groups[13];
-            case 9720 ... 9727: return &unique_character_groups[6];
-            case 9728 ... 9838: return &unique_character_groups[13];
-            case 9839: return &unique_character_groups[6];
-            case 9840 ... 10087: return &unique_character_groups[13];
-            case 10088: return &unique_character_groups[4];
-            case 10089: return &unique_character_groups[5];
-            case 10090: return &unique_character_groups[4];
-            case 10091: return &unique_character_groups[5];
-            case 10092: return &unique_character_groups[4];
-            case 10093: return &unique_character_groups[5];
-            case 10094: return &unique_character_groups[4];
-            case 10095: return &unique_character_groups[5];
-            case 10096: return &unique_character_groups[4];
-            case 10097: return &unique_character_groups[5];
-            case 10098: return &unique_character_groups[4];
-            case 10099: return &unique_character_groups[5];
-            case 10100: return &unique_character_groups[4];
-            case 10101: return &unique_character_groups[5];
-            case 10102 ... 10131: return &unique_character_groups[17];
-            case 10132 ... 10175: return &unique_character_groups[13];
-            case 10176 ... 10180: return &unique_character_groups[6];
-            case 10181: return &unique_character_groups[4];
-            case 10182: return &unique_character_groups[5];
-            case 10183 ... 10213: return &unique_character_groups[6];
-            case 10214: return &unique_character_groups[4];
-            case 10215: return &unique_character_groups[5];
-            case 10216: return &unique_character_groups[4];
-            case 10217: return &unique_character_groups[5];
-            case 10218: return &unique_character_groups[4];
-            case 10219: return &unique_character_groups[5];
-            case 10220: return &unique_character_groups[4];
-            case 10221: return &unique_character_groups[5];
-            case 10222: return &unique_character_groups[4];
-            case 10223: return &unique_character_groups[5];
-            case 10224 ... 10239: return &unique_character_groups[6];
-            case 10240 ... 10495: return &unique_character_groups[13];
-            case 10496 ... 10626: return &unique_character_groups[6];
-            case 10627: return &unique_character_groups[4];
-            case 10628: return &unique_character_groups[5];
-            case 10629: return &unique_character_groups[4];
-            case 10630: return &unique_character_groups[5];
-            case 10631: return &unique_character_groups[4];
-            case 10632: return &unique_character_groups[5];
-            case 10633: return &unique_character_groups[4];
-            case 10634: return &unique_character_groups[5];
-            case 10635: return &unique_character_groups[4];
-            case 10636: return &unique_character_groups[5];
-            case 10637: return &unique_character_groups[4];
-            case 10638: return &unique_character_groups[5];
-            case 10639: return &unique_character_groups[4];
-            case 10640: return &unique_character_groups[5];
-            case 10641: return &unique_character_groups[4];
-            case 10642: return &unique_character_groups[5];
-            case 10643: return &unique_character_groups[4];
-            case 10644: return &unique_character_groups[5];
-            case 10645: return &unique_character_groups[4];
-            case 10646: return &unique_character_groups[5];
-            case 10647: return &unique_character_groups[4];
-            case 10648: return &unique_character_groups[5];
-            case 10649 ... 10711: return &unique_character_groups[6];
-            case 10712: return &unique_character_groups[4];
-            case 10713: return &unique_character_groups[5];
-            case 10714: return &unique_character_groups[4];
-            case 10715: return &unique_character_groups[5];
-            case 10716 ... 10747: return &unique_character_groups[6];
-            case 10748: return &unique_character_groups[4];
-            case 10749: return &unique_character_groups[5];
-            case 10750 ... 11007: return &unique_character_groups[6];
-            case 11008 ... 11055: return &unique_character_groups[13];
-            case 11056 ... 11076: return &unique_character_groups[6];
-            case 11077 ... 11078: return &unique_character_groups[13];
-            case 11079 ... 11084: return &unique_character_groups[6];
-            case 11085 ... 11123: return &unique_character_groups[13];
-            case 11126 ... 11157: return &unique_character_groups[13];
-            case 11160 ... 11208: return &unique_character_groups[13];
-            case 11210 ... 11262: return &unique_character_groups[13];
-            case 11264 ... 11310: return &unique_character_groups[9];
-            case 11312 ... 11358: return &unique_character_groups[12];
-            case 11360: return &unique_character_groups[9];
-            case 11361: return &unique_character_groups[12];
-            case 11362 ... 11364: return &unique_character_groups[9];
-            case 11365 ... 11366: return &unique_character_groups[12];
-            case 11367: return &unique_character_groups[9];
-            case 11368: return &unique_character_groups[12];
-            case 11369: return &unique_character_groups[9];
-            case 11370: return &unique_character_groups[12];
-            case 11371: return &unique_character_groups[9];
-            case 11372: return &unique_character_groups[12];
-            case 11373 ... 11376: return &unique_character_groups[9];
-            case 11377: return &unique_character_groups[12];
-            case 11378: return &unique_character_groups[9];
-            case 11379 ... 11380: return &unique_character_groups[12];
-            case 11381: return &unique_character_groups[9];
-            case 11382 ... 11387: return &unique_character_groups[12];
-            case 11388 ... 11389: return &unique_character_groups[20];
-            case 11390 ... 11392: return &unique_character_groups[9];
-            case 11393: return &unique_character_groups[12];
-            case 11394: return &unique_character_groups[9];
-            case 11395: return &unique_character_groups[12];
-            case 11396: return &unique_character_groups[9];
-            case 11397: return &unique_character_groups[12];
-            case 11398: return &unique_character_groups[9];
-            case 11399: return &unique_character_groups[12];
-            case 11400: return &unique_character_groups[9];
-            case 11401: return &unique_character_groups[12];
-            case 11402: return &unique_character_groups[9];
-            case 11403: return &unique_character_groups[12];
-            case 11404: return &unique_character_groups[9];
-            case 11405: return &unique_character_groups[12];
-            case 11406: return &unique_character_groups[9];
-            case 11407: return &unique_character_groups[12];
-            case 11408: return &unique_character_groups[9];
-            case 11409: return &unique_character_groups[12];
-            case 11410: return &unique_character_groups[9];
-            case 11411: return &unique_character_groups[12];
-            case 11412: return &unique_character_groups[9];
-            case 11413: return &unique_character_groups[12];
-            case 11414: return &unique_character_groups[9];
-            case 11415: return &unique_character_groups[12];
-            case 11416: return &unique_character_groups[9];
-            case 11417: return &unique_character_groups[12];
-            case 11418: return &unique_character_groups[9];
-            case 11419: return &unique_character_groups[12];
-            case 11420: return &unique_character_groups[9];
-            case 11421: return &unique_character_groups[12];
-            case 11422: return &unique_character_groups[9];
-            case 11423: return &unique_character_groups[12];
-            case 11424: return &unique_character_groups[9];
-            case 11425: return &unique_character_groups[12];
-            case 11426: return &unique_character_groups[9];
-            case 11427: return &unique_character_groups[12];
-            case 11428: return &unique_character_groups[9];
-            case 11429: return &unique_character_groups[12];
-            case 11430: return &unique_character_groups[9];
-            case 11431: return &unique_character_groups[12];
-            case 11432: return &unique_character_groups[9];
-            case 11433: return &unique_character_groups[12];
-            case 11434: return &unique_character_groups[9];
-            case 11435: return &unique_character_groups[12];
-            case 11436: return &unique_character_groups[9];
-            case 11437: return &unique_character_groups[12];
-            case 11438: return &unique_character_groups[9];
-            case 11439: return &unique_character_groups[12];
-            case 11440: return &unique_character_groups[9];
-            case 11441: return &unique_character_groups[12];
-            case 11442: return &unique_character_groups[9];
-            case 11443: return &unique_character_groups[12];
-            case 11444: return &unique_character_groups[9];
-            case 11445: return &unique_character_groups[12];
-            case 11446: return &unique_character_groups[9];
-            case 11447: return &unique_character_groups[12];
-            case 11448: return &unique_character_groups[9];
-            case 11449: return &unique_character_groups[12];
-            case 11450: return &unique_character_groups[9];
-            case 11451: return &unique_character_groups[12];
-            case 11452: return &unique_character_groups[9];
-            case 11453: return &unique_character_groups[12];
-            case 11454: return &unique_character_groups[9];
-            case 11455: return &unique_character_groups[12];
-            case 11456: return &unique_character_groups[9];
-            case 11457: return &unique_character_groups[12];
-            case 11458: return &unique_character_groups[9];
-            case 11459: return &unique_character_groups[12];
-            case 11460: return &unique_character_groups[9];
-            case 11461: return &unique_character_groups[12];
-            case 11462: return &unique_character_groups[9];
-            case 11463: return &unique_character_groups[12];
-            case 11464: return &unique_character_groups[9];
-            case 11465: return &unique_character_groups[12];
-            case 11466: return &unique_character_groups[9];
-            case 11467: return &unique_character_groups[12];
-            case 11468: return &unique_character_groups[9];
-            case 11469: return &unique_character_groups[12];
-            case 11470: return &unique_character_groups[9];
-            case 11471: return &unique_character_groups[12];
-            case 11472: return &unique_character_groups[9];
-            case 11473: return &unique_character_groups[12];
-            case 11474: return &unique_character_groups[9];
-            case 11475: return &unique_character_groups[12];
-            case 11476: return &unique_character_groups[9];
-            case 11477: return &unique_character_groups[12];
-            case 11478: return &unique_character_groups[9];
-            case 11479: return &unique_character_groups[12];
-            case 11480: return &unique_character_groups[9];
-            case 11481: return &unique_character_groups[12];
-            case 11482: return &unique_character_groups[9];
-            case 11483: return &unique_character_groups[12];
-            case 11484: return &unique_character_groups[9];
-            case 11485: return &unique_character_groups[12];
-            case 11486: return &unique_character_groups[9];
-            case 11487: return &unique_character_groups[12];
-            case 11488: return &unique_character_groups[9];
-            case 11489: return &unique_character_groups[12];
-            case 11490: return &unique_character_groups[9];
-            case 11491 ... 11492: return &unique_character_groups[12];
-            case 11493 ... 11498: return &unique_character_groups[13];
-            case 11499: return &unique_character_groups[9];
-            case 11500: return &unique_character_groups[12];
-            case 11501: return &unique_character_groups[9];
-            case 11502: return &unique_character_groups[12];
-            case 11503 ... 11505: return &unique_character_groups[21];
-            case 11506: return &unique_character_groups[9];
-            case 11507: return &unique_character_groups[12];
-            case 11513 ... 11516: return &unique_character_groups[2];
-            case 11517: return &unique_character_groups[17];
-            case 11518 ... 11519: return &unique_character_groups[2];
-            case 11520 ... 11557: return &unique_character_groups[12];
-            case 11559: return &unique_character_groups[12];
-            case 11565: return &unique_character_groups[12];
-            case 11568 ... 11623: return &unique_character_groups[14];
-            case 11631: return &unique_character_groups[20];
-            case 11632: return &unique_character_groups[2];
-            case 11647: return &unique_character_groups[21];
-            case 11648 ... 11670: return &unique_character_groups[14];
-            case 11680 ... 11686: return &unique_character_groups[14];
-            case 11688 ... 11694: return &unique_character_groups[14];
-            case 11696 ... 11702: return &unique_character_groups[14];
-            case 11704 ... 11710: return &unique_character_groups[14];
-            case 11712 ... 11718: return &unique_character_groups[14];
-            case 11720 ... 11726: return &unique_character_groups[14];
-            case 11728 ... 11734: return &unique_character_groups[14];
-            case 11736 ... 11742: return &unique_character_groups[14];
-            case 11744 ... 11775: return &unique_character_groups[21];
-            case 11776 ... 11777: return &unique_character_groups[2];
-            case 11778: return &unique_character_groups[15];
-            case 11779: return &unique_character_groups[18];
-            case 11780: return &unique_character_groups[15];
-            case 11781: return &unique_character_groups[18];
-            case 11782 ... 11784: return &unique_character_groups[2];
-            case 11785: return &unique_character_groups[15];
-            case 11786: return &unique_character_groups[18];
-            case 11787: return &unique_character_groups[2];
-            case 11788: return &unique_character_groups[15];
-            case 11789: return &unique_character_groups[18];
-            case 11790 ... 11798: return &unique_character_groups[2];
-            case 11799: return &unique_character_groups[7];
-            case 11800 ... 11801: return &unique_character_groups[2];
-            case 11802: return &unique_character_groups[7];
-            case 11803: return &unique_character_groups[2];
-            case 11804: return &unique_character_groups[15];
-            case 11805: return &unique_character_groups[18];
-            case 11806 ... 11807: return &unique_character_groups[2];
-            case 11808: return &unique_character_groups[15];
-            case 11809: return &unique_character_groups[18];
-            case 11810: return &unique_character_groups[4];
-            case 11811: return &unique_character_groups[5];
-            case 11812: return &unique_character_groups[4];
-            case 11813: return &unique_character_groups[5];
-            case 11814: return &unique_character_groups[4];
-            case 11815: return &unique_character_groups[5];
-            case 11816: return &unique_character_groups[4];
-            case 11817: return &unique_character_groups[5];
-            case 11818 ... 11822: return &unique_character_groups[2];
-            case 11823: return &unique_character_groups[20];
-            case 11824 ... 11833: return &unique_character_groups[2];
-            case 11834 ... 11835: return &unique_character_groups[7];
-            case 11836 ... 11839: return &unique_character_groups[2];
-            case 11840: return &unique_character_groups[7];
-            case 11841: return &unique_character_groups[2];
-            case 11842: return &unique_character_groups[4];
-            case 11843 ... 11854: return &unique_character_groups[2];
-            case 11904 ... 11929: return &unique_character_groups[13];
-            case 11931 ... 12019: return &unique_character_groups[13];
-            case 12032 ... 12245: return &unique_character_groups[13];
-            case 12272 ... 12283: return &unique_character_groups[13];
-            case 12288: return &unique_character_groups[1];
-            case 12289 ... 12291: return &unique_character_groups[2];
-            case 12292: return &unique_character_groups[13];
-            case 12293: return &unique_character_groups[20];
-            case 12294: return &unique_character_groups[14];
-            case 12295: return &unique_character_groups[24];
-            case 12296: return &unique_character_groups[4];
-            case 12297: return &unique_character_groups[5];
-            case 12298: return &unique_character_groups[4];
-            case 12299: return &unique_character_groups[5];
-            case 12300: return &unique_character_groups[4];
-            case 12301: return &unique_character_groups[5];
-            case 12302: return &unique_character_groups[4];
-            case 12303: return &unique_character_groups[5];
-            case 12304: return &unique_character_groups[4];
-            case 12305: return &unique_character_groups[5];
-            case 12306 ... 12307: return &unique_character_groups[13];
-            case 12308: return &unique_character_groups[4];
-            case 12309: return &unique_character_groups[5];
-            case 12310: return &unique_character_groups[4];
-            case 12311: return &unique_character_groups[5];
-            case 12312: return &unique_character_groups[4];
-            case 12313: return &unique_character_groups[5];
-            case 12314: return &unique_character_groups[4];
-            case 12315: return &unique_character_groups[5];
-            case 12316: return &unique_character_groups[7];
-            case 12317: return &unique_character_groups[4];
-            case 12318 ... 12319: return &unique_character_groups[5];
-            case 12320: return &unique_character_groups[13];
-            case 12321 ... 12329: return &unique_character_groups[24];
-            case 12330 ... 12333: return &unique_character_groups[21];
-            case 12334 ... 12335: return &unique_character_groups[23];
-            case 12336: return &unique_character_groups[7];
-            case 12337 ... 12341: return &unique_character_groups[20];
-            case 12342 ... 12343: return &unique_character_groups[13];
-            case 12344 ... 12346: return &unique_character_groups[24];
-            case 12347: return &unique_character_groups[20];
-            case 12348: return &unique_character_groups[14];
-            case 12349: return &unique_character_groups[2];
-            case 12350 ... 12351: return &unique_character_groups[13];
-            case 12353 ... 12438: return &unique_character_groups[14];
-            case 12441 ... 12442: return &unique_character_groups[21];
-            case 12443 ... 12444: return &unique_character_groups[10];
-            case 12445 ... 12446: return &unique_character_groups[20];
-            case 12447: return &unique_character_groups[14];
-            case 12448: return &unique_character_groups[7];
-            case 12449 ... 12538: return &unique_character_groups[14];
-            case 12539: return &unique_character_groups[2];
-            case 12540 ... 12542: return &unique_character_groups[20];
-            case 12543: return &unique_character_groups[14];
-            case 12549 ... 12591: return &unique_character_groups[14];
-            case 12593 ... 12686: return &unique_character_groups[14];
-            case 12688 ... 12689: return &unique_character_groups[13];
-            case 12690 ... 12693: return &unique_character_groups[17];
-            case 12694 ... 12703: return &unique_character_groups[13];
-            case 12704 ... 12730: return &unique_character_groups[14];
-            case 12736 ... 12771: return &unique_character_groups[13];
-            case 12784 ... 12799: return &unique_character_groups[14];
-            case 12800 ... 12830: return &unique_character_groups[13];
-            case 12832 ... 12841: return &unique_character_groups[17];
-            case 12842 ... 12871: return &unique_character_groups[13];
-            case 12872 ... 12879: return &unique_character_groups[17];
-            case 12880: return &unique_character_groups[13];
-            case 12881 ... 12895: return &unique_character_groups[17];
-            case 12896 ... 12927: return &unique_character_groups[13];
-            case 12928 ... 12937: return &unique_character_groups[17];
-            case 12938 ... 12976: return &unique_character_groups[13];
-            case 12977 ... 12991: return &unique_character_groups[17];
-            case 12992 ... 13054: return &unique_character_groups[13];
-            case 13056 ... 13311: return &unique_character_groups[13];
-            case 13312: return &unique_character_groups[14];
-            case 19893: return &unique_character_groups[14];
-            case 19904 ... 19967: return &unique_character_groups[13];
-            case 19968: return &unique_character_groups[14];
-            case 40943: return &unique_character_groups[14];
-            case 40960 ... 40980: return &unique_character_groups[14];
-            case 40981: return &unique_character_groups[20];
-            case 40982 ... 42124: return &unique_character_groups[14];
-            case 42128 ... 42182: return &unique_character_groups[13];
-            case 42192 ... 42231: return &unique_character_groups[14];
-            case 42232 ... 42237: return &unique_character_groups[20];
-            case 42238 ... 42239: return &unique_character_groups[2];
-            case 42240 ... 42507: return &unique_character_groups[14];
-            case 42508: return &unique_character_groups[20];
-            case 42509 ... 42511: return &unique_character_groups[2];
-            case 42512 ... 42527: return &unique_character_groups[14];
-            case 42528 ... 42537: return &unique_character_groups[8];
-            case 42538 ... 42539: return &unique_character_groups[14];
-            case 42560: return &unique_character_groups[9];
-            case 42561: return &unique_character_groups[12];
-            case 42562: return &unique_character_groups[9];
-            case 42563: return &unique_character_groups[12];
-            case 42564: return &unique_character_groups[9];
-            case 42565: return &unique_character_groups[12];
-            case 42566: return &unique_character_groups[9];
-            case 42567: return &unique_character_groups[12];
-            case 42568: return &unique_character_groups[9];
-            case 42569: return &unique_character_groups[12];
-            case 42570: return &unique_character_groups[9];
-            case 42571: return &unique_character_groups[12];
-            case 42572: return &unique_character_groups[9];
-            case 42573: return &unique_character_groups[12];
-            case 42574: return &unique_character_groups[9];
-            case 42575: return &unique_character_groups[12];
-            case 42576: return &unique_character_groups[9];
-            case 42577: return &unique_character_groups[12];
-            case 42578: return &unique_character_groups[9];
-            case 42579: return &unique_character_groups[12];
-            case 42580: return &unique_character_groups[9];
-            case 42581: return &unique_character_groups[12];
-            case 42582: return &unique_character_groups[9];
-            case 42583: return &unique_character_groups[12];
-            case 42584: return &unique_character_groups[9];
-            case 42585: return &unique_character_groups[12];
-            case 42586: return &unique_character_groups[9];
-            case 42587: return &unique_character_groups[12];
-            case 42588: return &unique_character_groups[9];
-            case 42589: return &unique_character_groups[12];
-            case 42590: return &unique_character_groups[9];
-            case 42591: return &unique_character_groups[12];
-            case 42592: return &unique_character_groups[9];
-            case 42593: return &unique_character_groups[12];
-            case 42594: return &unique_character_groups[9];
-            case 42595: return &unique_character_groups[12];
-            case 42596: return &unique_character_groups[9];
-            case 42597: return &unique_character_groups[12];
-            case 42598: return &unique_character_groups[9];
-            case 42599: return &unique_character_groups[12];
-            case 42600: return &unique_character_groups[9];
-            case 42601: return &unique_character_groups[12];
-            case 42602: return &unique_character_groups[9];
-            case 42603: return &unique_character_groups[12];
-            case 42604: return &unique_character_groups[9];
-            case 42605: return &unique_character_groups[12];
-            case 42606: return &unique_character_groups[14];
-            case 42607: return &unique_character_groups[21];
-            case 42608 ... 42610: return &unique_character_groups[22];
-            case 42611: return &unique_character_groups[2];
-            case 42612 ... 42621: return &unique_character_groups[21];
-            case 42622: return &unique_character_groups[2];
-            case 42623: return &unique_character_groups[20];
-            case 42624: return &unique_character_groups[9];
-            case 42625: return &unique_character_groups[12];
-            case 42626: return &unique_character_groups[9];
-            case 42627: return &unique_character_groups[12];
-            case 42628: return &unique_character_groups[9];
-            case 42629: return &unique_character_groups[12];
-            case 42630: return &unique_character_groups[9];
-            case 42631: return &unique_character_groups[12];
-            case 42632: return &unique_character_groups[9];
-            case 42633: return &unique_character_groups[12];
-            case 42634: return &unique_character_groups[9];
-            case 42635: return &unique_character_groups[12];
-            case 42636: return &unique_character_groups[9];
-            case 42637: return &unique_character_groups[12];
-            case 42638: return &unique_character_groups[9];
-            case 42639: return &unique_character_groups[12];
-            case 42640: return &unique_character_groups[9];
-            case 42641: return &unique_character_groups[12];
-            case 42642: return &unique_character_groups[9];
-            case 42643: return &unique_character_groups[12];
-            case 42644: return &unique_character_groups[9];
-            case 42645: return &unique_character_groups[12];
-            case 42646: return &unique_character_groups[9];
-            case 42647: return &unique_character_groups[12];
-            case 42648: return &unique_character_groups[9];
-            case 42649: return &unique_character_groups[12];
-            case 42650: return &unique_character_groups[9];
-            case 42651: return &unique_character_groups[12];
-            case 42652 ... 42653: return &unique_character_groups[20];
-            case 42654 ... 42655: return &unique_character_groups[21];
-            case 42656 ... 42725: return &unique_character_groups[14];
-            case 42726 ... 42735: return &unique_character_groups[24];
-            case 42736 ... 42737: return &unique_character_groups[21];
-            case 42738 ... 42743: return &unique_character_groups[2];
-            case 42752 ... 42774: return &unique_character_groups[10];
-            case 42775 ... 42783: return &unique_character_groups[20];
-            case 42784 ... 42785: return &unique_character_groups[10];
-            case 42786: return &unique_character_groups[9];
-            case 42787: return &unique_character_groups[12];
-            case 42788: return &unique_character_groups[9];
-            case 42789: return &unique_character_groups[12];
-            case 42790: return &unique_character_groups[9];
-            case 42791: return &unique_character_groups[12];
-            case 42792: return &unique_character_groups[9];
-            case 42793: return &unique_character_groups[12];
-            case 42794: return &unique_character_groups[9];
-            case 42795: return &unique_character_groups[12];
-            case 42796: return &unique_character_groups[9];
-            case 42797: return &unique_character_groups[12];
-            case 42798: return &unique_character_groups[9];
-            case 42799 ... 42801: return &unique_character_groups[12];
-            case 42802: return &unique_character_groups[9];
-            case 42803: return &unique_character_groups[12];
-            case 42804: return &unique_character_groups[9];
-            case 42805: return &unique_character_groups[12];
-            case 42806: return &unique_character_groups[9];
-            case 42807: return &unique_character_groups[12];
-            case 42808: return &unique_character_groups[9];
-            case 42809: return &unique_character_groups[12];
-            case 42810: return &unique_character_groups[9];
-            case 42811: return &unique_character_groups[12];
-            case 42812: return &unique_character_groups[9];
-            case 42813: return &unique_character_groups[12];
-            case 42814: return &unique_character_groups[9];
-            case 42815: return &unique_character_groups[12];
-            case 42816: return &unique_character_groups[9];
-            case 42817: return &unique_character_groups[12];
-            case 42818: return &unique_character_groups[9];
-            case 42819: return &unique_character_groups[12];
-            case 42820: return &unique_character_groups[9];
-            case 42821: return &unique_character_groups[12];
-            case 42822: return &unique_character_groups[9];
-            case 42823: return &unique_character_groups[12];
-            case 42824: return &unique_character_groups[9];
-            case 42825: return &unique_character_groups[12];
-            case 42826: return &unique_character_groups[9];
-            case 42827: return &unique_character_groups[12];
-            case 42828: return &unique_character_groups[9];
-            case 42829: return &unique_character_groups[12];
-            case 42830: return &unique_character_groups[9];
-            case 42831: return &unique_character_groups[12];
-            case 42832: return &unique_character_groups[9];
-            case 42833: return &unique_character_groups[12];
-            case 42834: return &unique_character_groups[9];
-            case 42835: return &unique_character_groups[12];
-            case 42836: return &unique_character_groups[9];
-            case 42837: return &unique_character_groups[12];
-            case 42838: return &unique_character_groups[9];
-            case 42839: return &unique_character_groups[12];
-            case 42840: return &unique_character_groups[9];
-            case 42841: return &unique_character_groups[12];
-            case 42842: return &unique_character_groups[9];
-            case 42843: return &unique_character_groups[12];
-            case 42844: return &unique_character_groups[9];
-            case 42845: return &unique_character_groups[12];
-            case 42846: return &unique_character_groups[9];
-            case 42847: return &unique_character_groups[12];
-            case 42848: return &unique_character_groups[9];
-            case 42849: return &unique_character_groups[12];
-            case 42850: return &unique_character_groups[9];
-            case 42851: return &unique_character_groups[12];
-            case 42852: return &unique_character_groups[9];
-            case 42853: return &unique_character_groups[12];
-            case 42854: return &unique_character_groups[9];
-            case 42855: return &unique_character_groups[12];
-            case 42856: return &unique_character_groups[9];
-            case 42857: return &unique_character_groups[12];
-            case 42858: return &unique_character_groups[9];
-            case 42859: return &unique_character_groups[12];
-            case 42860: return &unique_character_groups[9];
-            case 42861: return &unique_character_groups[12];
-            case 42862: return &unique_character_groups[9];
-            case 42863: return &unique_character_groups[12];
-            case 42864: return &unique_character_groups[20];
-            case 42865 ... 42872: return &unique_character_groups[12];
-            case 42873: return &unique_character_groups[9];
-            case 42874: return &unique_character_groups[12];
-            case 42875: return &unique_character_groups[9];
-            case 42876: return &unique_character_groups[12];
-            case 42877 ... 42878: return &unique_character_groups[9];
-            case 42879: return &unique_character_groups[12];
-            case 42880: return &unique_character_groups[9];
-            case 42881: return &unique_character_groups[12];
-            case 42882: return &unique_character_groups[9];
-            case 42883: return &unique_character_groups[12];
-            case 42884: return &unique_character_groups[9];
-            case 42885: return &unique_character_groups[12];
-            case 42886: return &unique_character_groups[9];
-            case 42887: return &unique_character_groups[12];
-            case 42888: return &unique_character_groups[20];
-            case 42889 ... 42890: return &unique_character_groups[10];
-            case 42891: return &unique_character_groups[9];
-            case 42892: return &unique_character_groups[12];
-            case 42893: return &unique_character_groups[9];
-            case 42894: return &unique_character_groups[12];
-            case 42895: return &unique_character_groups[14];
-            case 42896: return &unique_character_groups[9];
-            case 42897: return &unique_character_groups[12];
-            case 42898: return &unique_character_groups[9];
-            case 42899 ... 42901: return &unique_character_groups[12];
-            case 42902: return &unique_character_groups[9];
-            case 42903: return &unique_character_groups[12];
-            case 42904: return &unique_character_groups[9];
-            case 42905: return &unique_character_groups[12];
-            case 42906: return &unique_character_groups[9];
-            case 42907: return &unique_character_groups[12];
-            case 42908: return &unique_character_groups[9];
-            case 42909: return &unique_character_groups[12];
-            case 42910: return &unique_character_groups[9];
-            case 42911: return &unique_character_groups[12];
-            case 42912: return &unique_character_groups[9];
-            case 42913: return &unique_character_groups[12];
-            case 42914: return &unique_character_groups[9];
-            case 42915: return &unique_character_groups[12];
-            case 42916: return &unique_character_groups[9];
-            case 42917: return &unique_character_groups[12];
-            case 42918: return &unique_character_groups[9];
-            case 42919: return &unique_character_groups[12];
-            case 42920: return &unique_character_groups[9];
-            case 42921: return &unique_character_groups[12];
-            case 42922 ... 42926: return &unique_character_groups[9];
-            case 42927: return &unique_character_groups[12];
-            case 42928 ... 42932: return &unique_character_groups[9];
-            case 42933: return &unique_character_groups[12];
-            case 42934: return &unique_character_groups[9];
-            case 42935: return &unique_character_groups[12];
-            case 42936: return &unique_character_groups[9];
-            case 42937: return &unique_character_groups[12];
-            case 42999: return &unique_character_groups[14];
-            case 43000 ... 43001: return &unique_character_groups[20];
-            case 43002: return &unique_character_groups[12];
-            case 43003 ... 43009: return &unique_character_groups[14];
-            case 43010: return &unique_character_groups[21];
-            case 43011 ... 43013: return &unique_character_groups[14];
-            case 43014: return &unique_character_groups[21];
-            case 43015 ... 43018: return &unique_character_groups[14];
-            case 43019: return &unique_character_groups[21];
-            case 43020 ... 43042: return &unique_character_groups[14];
-            case 43043 ... 43044: return &unique_character_groups[23];
-            case 43045 ... 43046: return &unique_character_groups[21];
-            case 43047: return &unique_character_groups[23];
-            case 43048 ... 43051: return &unique_character_groups[13];
-            case 43056 ... 43061: return &unique_character_groups[17];
-            case 43062 ... 43063: return &unique_character_groups[13];
-            case 43064: return &unique_character_groups[3];
-            case 43065: return &unique_character_groups[13];
-            case 43072 ... 43123: return &unique_character_groups[14];
-            case 43124 ... 43127: return &unique_character_groups[2];
-            case 43136 ... 43137: return &unique_character_groups[23];
-            case 43138 ... 43187: return &unique_character_groups[14];
-            case 43188 ... 43203: return &unique_character_groups[23];
-            case 43204 ... 43205: return &unique_character_groups[21];
-            case 43214 ... 43215: return &unique_character_groups[2];
-            case 43216 ... 43225: return &unique_character_groups[8];
-            case 43232 ... 43249: return &unique_character_groups[21];
-            case 43250 ... 43255: return &unique_character_groups[14];
-            case 43256 ... 43258: return &unique_character_groups[2];
-            case 43259: return &unique_character_groups[14];
-            case 43260: return &unique_character_groups[2];
-            case 43261 ... 43262: return &unique_character_groups[14];
-            case 43263: return &unique_character_groups[21];
-            case 43264 ... 43273: return &unique_character_groups[8];
-            case 43274 ... 43301: return &unique_character_groups[14];
-            case 43302 ... 43309: return &unique_character_groups[21];
-            case 43310 ... 43311: return &unique_character_groups[2];
-            case 43312 ... 43334: return &unique_character_groups[14];
-            case 43335 ... 43345: return &unique_character_groups[21];
-            case 43346 ... 43347: return &unique_character_groups[23];
-            case 43359: return &unique_character_groups[2];
-            case 43360 ... 43388: return &unique_character_groups[14];
-            case 43392 ... 43394: return &unique_character_groups[21];
-            case 43395: return &unique_character_groups[23];
-            case 43396 ... 43442: return &unique_character_groups[14];
-            case 43443: return &unique_character_groups[21];
-            case 43444 ... 43445: return &unique_character_groups[23];
-            case 43446 ... 43449: return &unique_character_groups[21];
-            case 43450 ... 43451: return &unique_character_groups[23];
-            case 43452: return &unique_character_groups[21];
-            case 43453 ... 43456: return &unique_character_groups[23];
-            case 43457 ... 43469: return &unique_character_groups[2];
-            case 43471: return &unique_character_groups[20];
-            case 43472 ... 43481: return &unique_character_groups[8];
-            case 43486 ... 43487: return &unique_character_groups[2];
-            case 43488 ... 43492: return &unique_character_groups[14];
-            case 43493: return &unique_character_groups[21];
-            case 43494: return &unique_character_groups[20];
-            case 43495 ... 43503: return &unique_character_groups[14];
-            case 43504 ... 43513: return &unique_character_groups[8];
-            case 43514 ... 43518: return &unique_character_groups[14];
-            case 43520 ... 43560: return &unique_character_groups[14];
-            case 43561 ... 43566: return &unique_character_groups[21];
-            case 43567 ... 43568: return &unique_character_groups[23];
-            case 43569 ... 43570: return &unique_character_groups[21];
-            case 43571 ... 43572: return &unique_character_groups[23];
-            case 43573 ... 43574: return &unique_character_groups[21];
-            case 43584 ... 43586: return &unique_character_groups[14];
-            case 43587: return &unique_character_groups[21];
-            case 43588 ... 43595: return &unique_character_groups[14];
-            case 43596: return &unique_character_groups[21];
-            case 43597: return &unique_character_groups[23];
-            case 43600 ... 43609: return &unique_character_groups[8];
-            case 43612 ... 43615: return &unique_character_groups[2];
-            case 43616 ... 43631: return &unique_character_groups[14];
-            case 43632: return &unique_character_groups[20];
-            case 43633 ... 43638: return &unique_character_groups[14];
-            case 43639 ... 43641: return &unique_character_groups[13];
-            case 43642: return &unique_character_groups[14];
-            case 43643: return &unique_character_groups[23];
-            case 43644: return &unique_character_groups[21];
-            case 43645: return &unique_character_groups[23];
-            case 43646 ... 43695: return &unique_character_groups[14];
-            case 43696: return &unique_character_groups[21];
-            case 43697: return &unique_character_groups[14];
-            case 43698 ... 43700: return &unique_character_groups[21];
-            case 43701 ... 43702: return &unique_character_groups[14];
-            case 43703 ... 43704: return &unique_character_groups[21];
-            case 43705 ... 43709: return &unique_character_groups[14];
-            case 43710 ... 43711: return &unique_character_groups[21];
-            case 43712: return &unique_character_groups[14];
-            case 43713: return &unique_character_groups[21];
-            case 43714: return &unique_character_groups[14];
-            case 43739 ... 43740: return &unique_character_groups[14];
-            case 43741: return &unique_character_groups[20];
-            case 43742 ... 43743: return &unique_character_groups[2];
-            case 43744 ... 43754: return &unique_character_groups[14];
-            case 43755: return &unique_character_groups[23];
-            case 43756 ... 43757: return &unique_character_groups[21];
-            case 43758 ... 43759: return &unique_character_groups[23];
-            case 43760 ... 43761: return &unique_character_groups[2];
-            case 43762: return &unique_character_groups[14];
-            case 43763 ... 43764: return &unique_character_groups[20];
-            case 43765: return &unique_character_groups[23];
-            case 43766: return &unique_character_groups[21];
-            case 43777 ... 43782: return &unique_character_groups[14];
-            case 43785 ... 43790: return &unique_character_groups[14];
-            case 43793 ... 43798: return &unique_character_groups[14];
-            case 43808 ... 43814: return &unique_character_groups[14];
-            case 43816 ... 43822: return &unique_character_groups[14];
-            case 43824 ... 43866: return &unique_character_groups[12];
-            case 43867: return &unique_character_groups[10];
-            case 43868 ... 43871: return &unique_character_groups[20];
-            case 43872 ... 43877: return &unique_character_groups[12];
-            case 43888 ... 43967: return &unique_character_groups[12];
-            case 43968 ... 44002: return &unique_character_groups[14];
-            case 44003 ... 44004: return &unique_character_groups[23];
-            case 44005: return &unique_character_groups[21];
-            case 44006 ... 44007: return &unique_character_groups[23];
-            case 44008: return &unique_character_groups[21];
-            case 44009 ... 44010: return &unique_character_groups[23];
-            case 44011: return &unique_character_groups[2];
-            case 44012: return &unique_character_groups[23];
-            case 44013: return &unique_character_groups[21];
-            case 44016 ... 44025: return &unique_character_groups[8];
-            case 44032: return &unique_character_groups[14];
-            case 55203: return &unique_character_groups[14];
-            case 55216 ... 55238: return &unique_character_groups[14];
-            case 55243 ... 55291: return &unique_character_groups[14];
-            case 55296: return &unique_character_groups[28];
-            case 56191 ... 56192: return &unique_character_groups[28];
-            case 56319 ... 56320: return &unique_character_groups[28];
-            case 57343: return &unique_character_groups[28];
-            case 57344: return &unique_character_groups[29];
-            case 63743: return &unique_character_groups[29];
-            case 63744 ... 64109: return &unique_character_groups[14];
-            case 64112 ... 64217: return &unique_character_groups[14];
-            case 64256 ... 64262: return &unique_character_groups[12];
-            case 64275 ... 64279: return &unique_character_groups[12];
-            case 64285: return &unique_character_groups[14];
-            case 64286: return &unique_character_groups[21];
-            case 64287 ... 64296: return &unique_character_groups[14];
-            case 64297: return &unique_character_groups[6];
-            case 64298 ... 64310: return &unique_character_groups[14];
-            case 64312 ... 64316: return &unique_character_groups[14];
-            case 64318: return &unique_character_groups[14];
-            case 64320 ... 64321: return &unique_character_groups[14];
-            case 64323 ... 64324: return &unique_character_groups[14];
-            case 64326 ... 64433: return &unique_character_groups[14];
-            case 64434 ... 64449: return &unique_character_groups[10];
-            case 64467 ... 64829: return &unique_character_groups[14];
-            case 64830: return &unique_character_groups[5];
-            case 64831: return &unique_character_groups[4];
-            case 64848 ... 64911: return &unique_character_groups[14];
-            case 64914 ... 64967: return &unique_character_groups[14];
-            case 65008 ... 65019: return &unique_character_groups[14];
-            case 65020: return &unique_character_groups[3];
-            case 65021: return &unique_character_groups[13];
-            case 65024 ... 65039: return &unique_character_groups[21];
-            case 65040 ... 65046: return &unique_character_groups[2];
-            case 65047: return &unique_character_groups[4];
-            case 65048: return &unique_character_groups[5];
-            case 65049: return &unique_character_groups[2];
-            case 65056 ... 65071: return &unique_character_groups[21];
-            case 65072: return &unique_character_groups[2];
-            case 65073 ... 65074: return &unique_character_groups[7];
-            case 65075 ... 65076: return &unique_character_groups[11];
-            case 65077: return &unique_character_groups[4];
-            case 65078: return &unique_character_groups[5];
-            case 65079: return &unique_character_groups[4];
-            case 65080: return &unique_character_groups[5];
-            case 65081: return &unique_character_groups[4];
-            case 65082: return &unique_character_groups[5];
-            case 65083: return &unique_character_groups[4];
-            case 65084: return &unique_character_groups[5];
-            case 65085: return &unique_character_groups[4];
-            case 65086: return &unique_character_groups[5];
-            case 65087: return &unique_character_groups[4];
-            case 65088: return &unique_character_groups[5];
-            case 65089: return &unique_character_groups[4];
-            case 65090: return &unique_character_groups[5];
-            case 65091: return &unique_character_groups[4];
-            case 65092: return &unique_character_groups[5];
-            case 65093 ... 65094: return &unique_character_groups[2];
-            case 65095: return &unique_character_groups[4];
-            case 65096: return &unique_character_groups[5];
-            case 65097 ... 65100: return &unique_character_groups[2];
-            case 65101 ... 65103: return &unique_character_groups[11];
-            case 65104 ... 65106: return &unique_character_groups[2];
-            case 65108 ... 65111: return &unique_character_groups[2];
-            case 65112: return &unique_character_groups[7];
-            case 65113: return &unique_character_groups[4];
-            case 65114: return &unique_character_groups[5];
-            case 65115: return &unique_character_groups[4];
-            case 65116: return &unique_character_groups[5];
-            case 65117: return &unique_character_groups[4];
-            case 65118: return &unique_character_groups[5];
-            case 65119 ... 65121: return &unique_character_groups[2];
-            case 65122: return &unique_character_groups[6];
-            case 65123: return &unique_character_groups[7];
-            case 65124 ... 65126: return &unique_character_groups[6];
-            case 65128: return &unique_character_groups[2];
-            case 65129: return &unique_character_groups[3];
-            case 65130 ... 65131: return &unique_character_groups[2];
-            case 65136 ... 65140: return &unique_character_groups[14];
-            case 65142 ... 65276: return &unique_character_groups[14];
-            case 65279: return &unique_character_groups[16];
-            case 65281 ... 65283: return &unique_character_groups[2];
-            case 65284: return &unique_character_groups[3];
-            case 65285 ... 65287: return &unique_character_groups[2];
-            case 65288: return &unique_character_groups[4];
-            case 65289: return &unique_character_groups[5];
-            case 65290: return &unique_character_groups[2];
-            case 65291: return &unique_character_groups[6];
-            case 65292: return &unique_character_groups[2];
-            case 65293: return &unique_character_groups[7];
-            case 65294 ... 65295: return &unique_character_groups[2];
-            case 65296 ... 65305: return &unique_character_groups[8];
-            case 65306 ... 65307: return &unique_character_groups[2];
-            case 65308 ... 65310: return &unique_character_groups[6];
-            case 65311 ... 65312: return &unique_character_groups[2];
-            case 65313 ... 65338: return &unique_character_groups[9];
-            case 65339: return &unique_character_groups[4];
-            case 65340: return &unique_character_groups[2];
-            case 65341: return &unique_character_groups[5];
-            case 65342: return &unique_character_groups[10];
-            case 65343: return &unique_character_groups[11];
-            case 65344: return &unique_character_groups[10];
-            case 65345 ... 65370: return &unique_character_groups[12];
-            case 65371: return &unique_character_groups[4];
-            case 65372: return &unique_character_groups[6];
-            case 65373: return &unique_character_groups[5];
-            case 65374: return &unique_character_groups[6];
-            case 65375: return &unique_character_groups[4];
-            case 65376: return &unique_character_groups[5];
-            case 65377: return &unique_character_groups[2];
-            case 65378: return &unique_character_groups[4];
-            case 65379: return &unique_character_groups[5];
-            case 65380 ... 65381: return &unique_character_groups[2];
-            case 65382 ... 65391: return &unique_character_groups[14];
-            case 65392: return &unique_character_groups[20];
-            case 65393 ... 65437: return &unique_character_groups[14];
-            case 65438 ... 65439: return &unique_character_groups[20];
-            case 65440 ... 65470: return &unique_character_groups[14];
-            case 65474 ... 65479: return &unique_character_groups[14];
-            case 65482 ... 65487: return &unique_character_groups[14];
-            case 65490 ... 65495: return &unique_character_groups[14];
-            case 65498 ... 65500: return &unique_character_groups[14];
-            case 65504 ... 65505: return &unique_character_groups[3];
-            case 65506: return &unique_character_groups[6];
-            case 65507: return &unique_character_groups[10];
-            case 65508: return &unique_character_groups[13];
-            case 65509 ... 65510: return &unique_character_groups[3];
-            case 65512: return &unique_character_groups[13];
-            case 65513 ... 65516: return &unique_character_groups[6];
-            case 65517 ... 65518: return &unique_character_groups[13];
-            case 65529 ... 65531: return &unique_character_groups[16];
-            case 65532 ... 65533: return &unique_character_groups[13];
-            case 65536 ... 65547: return &unique_character_groups[14];
-            case 65549 ... 65574: return &unique_character_groups[14];
-            case 65576 ... 65594: return &unique_character_groups[14];
-            case 65596 ... 65597: return &unique_character_groups[14];
-            case 65599 ... 65613: return &unique_character_groups[14];
-            case 65616 ... 65629: return &unique_character_groups[14];
-            case 65664 ... 65786: return &unique_character_groups[14];
-            case 65792 ... 65794: return &unique_character_groups[2];
-            case 65799 ... 65843: return &unique_character_groups[17];
-            case 65847 ... 65855: return &unique_character_groups[13];
-            case 65856 ... 65908: return &unique_character_groups[24];
-            case 65909 ... 65912: return &unique_character_groups[17];
-            case 65913 ... 65929: return &unique_character_groups[13];
-            case 65930 ... 65931: return &unique_character_groups[17];
-            case 65932 ... 65934: return &unique_character_groups[13];
-            case 65936 ... 65947: return &unique_character_groups[13];
-            case 65952: return &unique_character_groups[13];
-            case 66000 ... 66044: return &unique_character_groups[13];
-            case 66045: return &unique_character_groups[21];
-            case 66176 ... 66204: return &unique_character_groups[14];
-            case 66208 ... 66256: return &unique_character_groups[14];
-            case 66272: return &unique_character_groups[21];
-            case 66273 ... 66299: return &unique_character_groups[17];
-            case 66304 ... 66335: return &unique_character_groups[14];
-            case 66336 ... 66339: return &unique_character_groups[17];
-            case 66349 ... 66368: return &unique_character_groups[14];
-            case 66369: return &unique_character_groups[24];
-            case 66370 ... 66377: return &unique_character_groups[14];
-            case 66378: return &unique_character_groups[24];
-            case 66384 ... 66421: return &unique_character_groups[14];
-            case 66422 ... 66426: return &unique_character_groups[21];
-            case 66432 ... 66461: return &unique_character_groups[14];
-            case 66463: return &unique_character_groups[2];
-            case 66464 ... 66499: return &unique_character_groups[14];
-            case 66504 ... 66511: return &unique_character_groups[14];
-            case 66512: return &unique_character_groups[2];
-            case 66513 ... 66517: return &unique_character_groups[24];
-            case 66560 ... 66599: return &unique_character_groups[9];
-            case 66600 ... 66639: return &unique_character_groups[12];
-            case 66640 ... 66717: return &unique_character_groups[14];
-            case 66720 ... 66729: return &unique_character_groups[8];
-            case 66736 ... 66771: return &unique_character_groups[9];
-            case 66776 ... 66811: return &unique_character_groups[12];
-            case 66816 ... 66855: return &unique_character_groups[14];
-            case 66864 ... 66915: return &unique_character_groups[14];
-            case 66927: return &unique_character_groups[2];
-            case 67072 ... 67382: return &unique_character_groups[14];
-            case 67392 ... 67413: return &unique_character_groups[14];
-            case 67424 ... 67431: return &unique_character_groups[14];
-            case 67584 ... 67589: return &unique_character_groups[14];
-            case 67592: return &unique_character_groups[14];
-            case 67594 ... 67637: return &unique_character_groups[14];
-            case 67639 ... 67640: return &unique_character_groups[14];
-            case 67644: return &unique_character_groups[14];
-            case 67647 ... 67669: return &unique_character_groups[14];
-            case 67671: return &unique_character_groups[2];
-            case 67672 ... 67679: return &unique_character_groups[17];
-            case 67680 ... 67702: return &unique_character_groups[14];
-            case 67703 ... 67704: return &unique_character_groups[13];
-            case 67705 ... 67711: return &unique_character_groups[17];
-            case 67712 ... 67742: return &unique_character_groups[14];
-            case 67751 ... 67759: return &unique_character_groups[17];
-            case 67808 ... 67826: return &unique_character_groups[14];
-            case 67828 ... 67829: return &unique_character_groups[14];
-            case 67835 ... 67839: return &unique_character_groups[17];
-            case 67840 ... 67861: return &unique_character_groups[14];
-            case 67862 ... 67867: return &unique_character_groups[17];
-            case 67871: return &unique_character_groups[2];
-            case 67872 ... 67897: return &unique_character_groups[14];
-            case 67903: return &unique_character_groups[2];
-            case 67968 ... 68023: return &unique_character_groups[14];
-            case 68028 ... 68029: return &unique_character_groups[17];
-            case 68030 ... 68031: return &unique_character_groups[14];
-            case 68032 ... 68047: return &unique_character_groups[17];
-            case 68050 ... 68095: return &unique_character_groups[17];
-            case 68096: return &unique_character_groups[14];
-            case 68097 ... 68099: return &unique_character_groups[21];
-            case 68101 ... 68102: return &unique_character_groups[21];
-            case 68108 ... 68111: return &unique_character_groups[21];
-            case 68112 ... 68115: return &unique_character_groups[14];
-            case 68117 ... 68119: return &unique_character_groups[14];
-            case 68121 ... 68149: return &unique_character_groups[14];
-            case 68152 ... 68154: return &unique_character_groups[21];
-            case 68159: return &unique_character_groups[21];
-            case 68160 ... 68168: return &unique_character_groups[17];
-            case 68176 ... 68184: return &unique_character_groups[2];
-            case 68192 ... 68220: return &unique_character_groups[14];
-            case 68221 ... 68222: return &unique_character_groups[17];
-            case 68223: return &unique_character_groups[2];
-            case 68224 ... 68252: return &unique_character_groups[14];
-            case 68253 ... 68255: return &unique_character_groups[17];
-            case 68288 ... 68295: return &unique_character_groups[14];
-            case 68296: return &unique_character_groups[13];
-            case 68297 ... 68324: return &unique_character_groups[14];
-            case 68325 ... 68326: return &unique_character_groups[21];
-            case 68331 ... 68335: return &unique_character_groups[17];
-            case 68336 ... 68342: return &unique_character_groups[2];
-            case 68352 ... 68405: return &unique_character_groups[14];
-            case 68409 ... 68415: return &unique_character_groups[2];
-            case 68416 ... 68437: return &unique_character_groups[14];
-            case 68440 ... 68447: return &unique_character_groups[17];
-            case 68448 ... 68466: return &unique_character_groups[14];
-            case 68472 ... 68479: return &unique_character_groups[17];
-            case 68480 ... 68497: return &unique_character_groups[14];
-            case 68505 ... 68508: return &unique_character_groups[2];
-            case 68521 ... 68527: return &unique_character_groups[17];
-            case 68608 ... 68680: return &unique_character_groups[14];
-            case 68736 ... 68786: return &unique_character_groups[9];
-            case 68800 ... 68850: return &unique_character_groups[12];
-            case 68858 ... 68863: return &unique_character_groups[17];
-            case 68864 ... 68899: return &unique_character_groups[14];
-            case 68900 ... 68903: return &unique_character_groups[21];
-            case 68912 ... 68921: return &unique_character_groups[8];
-            case 69216 ... 69246: return &unique_character_groups[17];
-            case 69376 ... 69404: return &unique_character_groups[14];
-            case 69405 ... 69414: return &unique_character_groups[17];
-            case 69415: return &unique_character_groups[14];
-            case 69424 ... 69445: return &unique_character_groups[14];
-            case 69446 ... 69456: return &unique_character_groups[21];
-            case 69457 ... 69460: return &unique_character_groups[17];
-            case 69461 ... 69465: return &unique_character_groups[2];
-            case 69632: return &unique_character_groups[23];
-            case 69633: return &unique_character_groups[21];
-            case 69634: return &unique_character_groups[23];
-            case 69635 ... 69687: return &unique_character_groups[14];
-            case 69688 ... 69702: return &unique_character_groups[21];
-            case 69703 ... 69709: return &unique_character_groups[2];
-            case 69714 ... 69733: return &unique_character_groups[17];
-            case 69734 ... 69743: return &unique_character_groups[8];
-            case 69759 ... 69761: return &unique_character_groups[21];
-            case 69762: return &unique_character_groups[23];
-            case 69763 ... 69807: return &unique_character_groups[14];
-            case 69808 ... 69810: return &unique_character_groups[23];
-            case 69811 ... 69814: return &unique_character_groups[21];
-            case 69815 ... 69816: return &unique_character_groups[23];
-            case 69817 ... 69818: return &unique_character_groups[21];
-            case 69819 ... 69820: return &unique_character_groups[2];
-            case 69821: return &unique_character_groups[16];
-            case 69822 ... 69825: return &unique_character_groups[2];
-            case 69837: return &unique_character_groups[16];
-            case 69840 ... 69864: return &unique_character_groups[14];
-            case 69872 ... 69881: return &unique_character_groups[8];
-            case 69888 ... 69890: return &unique_character_groups[21];
-            case 69891 ... 69926: return &unique_character_groups[14];
-            case 69927 ... 69931: return &unique_character_groups[21];
-            case 69932: return &unique_character_groups[23];
-            case 69933 ... 69940: return &unique_character_groups[21];
-            case 69942 ... 69951: return &unique_character_groups[8];
-            case 69952 ... 69955: return &unique_character_groups[2];
-            case 69956: return &unique_character_groups[14];
-            case 69957 ... 69958: return &unique_character_groups[23];
-            case 69968 ... 70002: return &unique_character_groups[14];
-            case 70003: return &unique_character_groups[21];
-            case 70004 ... 70005: return &unique_character_groups[2];
-            case 70006: return &unique_character_groups[14];
-            case 70016 ... 70017: return &unique_character_groups[21];
-            case 70018: return &unique_character_groups[23];
-            case 70019 ... 70066: return &unique_character_groups[14];
-            case 70067 ... 70069: return &unique_character_groups[23];
-            case 70070 ... 70078: return &unique_character_groups[21];
-            case 70079 ... 70080: return &unique_character_groups[23];
-            case 70081 ... 70084: return &unique_character_groups[14];
-            case 70085 ... 70088: return &unique_character_groups[2];
-            case 70089 ... 70092: return &unique_character_groups[21];
-            case 70093: return &unique_character_groups[2];
-            case 70096 ... 70105: return &unique_character_groups[8];
-            case 70106: return &unique_character_groups[14];
-            case 70107: return &unique_character_groups[2];
-            case 70108: return &unique_character_groups[14];
-            case 70109 ... 70111: return &unique_character_groups[2];
-            case 70113 ... 70132: return &unique_character_groups[17];
-            case 70144 ... 70161: return &unique_character_groups[14];
-            case 70163 ... 70187: return &unique_character_groups[14];
-            case 70188 ... 70190: return &unique_character_groups[23];
-            case 70191 ... 70193: return &unique_character_groups[21];
-            case 70194 ... 70195: return &unique_character_groups[23];
-            case 70196: return &unique_character_groups[21];
-            case 70197: return &unique_character_groups[23];
-            case 70198 ... 70199: return &unique_character_groups[21];
-            case 70200 ... 70205: return &unique_character_groups[2];
-            case 70206: return &unique_character_groups[21];
-            case 70272 ... 70278: return &unique_character_groups[14];
-            case 70280: return &unique_character_groups[14];
-            case 70282 ... 70285: return &unique_character_groups[14];
-            case 70287 ... 70301: return &unique_character_groups[14];
-            case 70303 ... 70312: return &unique_character_groups[14];
-            case 70313: return &unique_character_groups[2];
-            case 70320 ... 70366: return &unique_character_groups[14];
-            case 70367: return &unique_character_groups[21];
-            case 70368 ... 70370: return &unique_character_groups[23];
-            case 70371 ... 70378: return &unique_character_groups[21];
-            case 70384 ... 70393: return &unique_character_groups[8];
-            case 70400 ... 70401: return &unique_character_groups[21];
-            case 70402 ... 70403: return &unique_character_groups[23];
-            case 70405 ... 70412: return &unique_character_groups[14];
-            case 70415 ... 70416: return &unique_character_groups[14];
-            case 70419 ... 70440: return &unique_character_groups[14];
-            case 70442 ... 70448: return &unique_character_groups[14];
-            case 70450 ... 70451: return &unique_character_groups[14];
-            case 70453 ... 70457: return &unique_character_groups[14];
-            case 70459 ... 70460: return &unique_character_groups[21];
-            case 70461: return &unique_character_groups[14];
-            case 70462 ... 70463: return &unique_character_groups[23];
-            case 70464: return &unique_character_groups[21];
-            case 70465 ... 70468: return &unique_character_groups[23];
-            case 70471 ... 70472: return &unique_character_groups[23];
-            case 70475 ... 70477: return &unique_character_groups[23];
-            case 70480: return &unique_character_groups[14];
-            case 70487: return &unique_character_groups[23];
-            case 70493 ... 70497: return &unique_character_groups[14];
-            case 70498 ... 70499: return &unique_character_groups[23];
-            case 70502 ... 70508: return &unique_character_groups[21];
-            case 70512 ... 70516: return &unique_character_groups[21];
-            case 70656 ... 70708: return &unique_character_groups[14];
-            case 70709 ... 70711: return &unique_character_groups[23];
-            case 70712 ... 70719: return &unique_character_groups[21];
-            case 70720 ... 70721: return &unique_character_groups[23];
-            case 70722 ... 70724: return &unique_character_groups[21];
-            case 70725: return &unique_character_groups[23];
-            case 70726: return &unique_character_groups[21];
-            case 70727 ... 70730: return &unique_character_groups[14];
-            case 70731 ... 70735: return &unique_character_groups[2];
-            case 70736 ... 70745: return &unique_character_groups[8];
-            case 70747: return &unique_character_groups[2];
-            case 70749: return &unique_character_groups[2];
-            case 70750: return &unique_character_groups[21];
-            case 70784 ... 70831: return &unique_character_groups[14];
-            case 70832 ... 70834: return &unique_character_groups[23];
-            case 70835 ... 70840: return &unique_character_groups[21];
-            case 70841: return &unique_character_groups[23];
-            case 70842: return &unique_character_groups[21];
-            case 70843 ... 70846: return &unique_character_groups[23];
-            case 70847 ... 70848: return &unique_character_groups[21];
-            case 70849: return &unique_character_groups[23];
-            case 70850 ... 70851: return &unique_character_groups[21];
-            case 70852 ... 70853: return &unique_character_groups[14];
-            case 70854: return &unique_character_groups[2];
-            case 70855: return &unique_character_groups[14];
-            case 70864 ... 70873: return &unique_character_groups[8];
-            case 71040 ... 71086: return &unique_character_groups[14];
-            case 71087 ... 71089: return &unique_character_groups[23];
-            case 71090 ... 71093: return &unique_character_groups[21];
-            case 71096 ... 71099: return &unique_character_groups[23];
-            case 71100 ... 71101: return &unique_character_groups[21];
-            case 71102: return &unique_character_groups[23];
-            case 71103 ... 71104: return &unique_character_groups[21];
-            case 71105 ... 71127: return &unique_character_groups[2];
-            case 71128 ... 71131: return &unique_character_groups[14];
-            case 71132 ... 71133: return &unique_character_groups[21];
-            case 71168 ... 71215: return &unique_character_groups[14];
-            case 71216 ... 71218: return &unique_character_groups[23];
-            case 71219 ... 71226: return &unique_character_groups[21];
-            case 71227 ... 71228: return &unique_character_groups[23];
-            case 71229: return &unique_character_groups[21];
-            case 71230: return &unique_character_groups[23];
-            case 71231 ... 71232: return &unique_character_groups[21];
-            case 71233 ... 71235: return &unique_character_groups[2];
-            case 71236: return &unique_character_groups[14];
-            case 71248 ... 71257: return &unique_character_groups[8];
-            case 71264 ... 71276: return &unique_character_groups[2];
-            case 71296 ... 71338: return &unique_character_groups[14];
-            case 71339: return &unique_character_groups[21];
-            case 71340: return &unique_character_groups[23];
-            case 71341: return &unique_character_groups[21];
-            case 71342 ... 71343: return &unique_character_groups[23];
-            case 71344 ... 71349: return &unique_character_groups[21];
-            case 71350: return &unique_character_groups[23];
-            case 71351: return &unique_character_groups[21];
-            case 71360 ... 71369: return &unique_character_groups[8];
-            case 71424 ... 71450: return &unique_character_groups[14];
-            case 71453 ... 71455: return &unique_character_groups[21];
-            case 71456 ... 71457: return &unique_character_groups[23];
-            case 71458 ... 71461: return &unique_character_groups[21];
-            case 71462: return &unique_character_groups[23];
-            case 71463 ... 71467: return &unique_character_groups[21];
-            case 71472 ... 71481: return &unique_character_groups[8];
-            case 71482 ... 71483: return &unique_character_groups[17];
-            case 71484 ... 71486: return &unique_character_groups[2];
-            case 71487: return &unique_character_groups[13];
-            case 71680 ... 71723: return &unique_character_groups[14];
-            case 71724 ... 71726: return &unique_character_groups[23];
-            case 71727 ... 71735: return &unique_character_groups[21];
-            case 71736: return &unique_character_groups[23];
-            case 71737 ... 71738: return &unique_character_groups[21];
-            case 71739: return &unique_character_groups[2];
-            case 71840 ... 71871: return &unique_character_groups[9];
-            case 71872 ... 71903: return &unique_character_groups[12];
-            case 71904 ... 71913: return &unique_character_groups[8];
-            case 71914 ... 71922: return &unique_character_groups[17];
-            case 71935: return &unique_character_groups[14];
-            case 72192: return &unique_character_groups[14];
-            case 72193 ... 72202: return &unique_character_groups[21];
-            case 72203 ... 72242: return &unique_character_groups[14];
-            case 72243 ... 72248: return &unique_character_groups[21];
-            case 72249: return &unique_character_groups[23];
-            case 72250: return &unique_character_groups[14];
-            case 72251 ... 72254: return &unique_character_groups[21];
-            case 72255 ... 72262: return &unique_character_groups[2];
-            case 72263: return &unique_character_groups[21];
-            case 72272: return &unique_character_groups[14];
-            case 72273 ... 72278: return &unique_character_groups[21];
-            case 72279 ... 72280: return &unique_character_groups[23];
-            case 72281 ... 72283: return &unique_character_groups[21];
-            case 72284 ... 72323: return &unique_character_groups[14];
-            case 72326 ... 72329: return &unique_character_groups[14];
-            case 72330 ... 72342: return &unique_character_groups[21];
-            case 72343: return &unique_character_groups[23];
-            case 72344 ... 72345: return &unique_character_groups[21];
-            case 72346 ... 72348: return &unique_character_groups[2];
-            case 72349: return &unique_character_groups[14];
-            case 72350 ... 72354: return &unique_character_groups[2];
-            case 72384 ... 72440: return &unique_character_groups[14];
-            case 72704 ... 72712: return &unique_character_groups[14];
-            case 72714 ... 72750: return &unique_character_groups[14];
-            case 72751: return &unique_character_groups[23];
-            case 72752 ... 72758: return &unique_character_groups[21];
-            case 72760 ... 72765: return &unique_character_groups[21];
-            case 72766: return &unique_character_groups[23];
-            case 72767: return &unique_character_groups[21];
-            case 72768: return &unique_character_groups[14];
-            case 72769 ... 72773: return &unique_character_groups[2];
-            case 72784 ... 72793: return &unique_character_groups[8];
-            case 72794 ... 72812: return &unique_character_groups[17];
-            case 72816 ... 72817: return &unique_character_groups[2];
-            case 72818 ... 72847: return &unique_character_groups[14];
-            case 72850 ... 72871: return &unique_character_groups[21];
-            case 72873: return &unique_character_groups[23];
-            case 72874 ... 72880: return &unique_character_groups[21];
-            case 72881: return &unique_character_groups[23];
-            case 72882 ... 72883: return &unique_character_groups[21];
-            case 72884: return &unique_character_groups[23];
-            case 72885 ... 72886: return &unique_character_groups[21];
-            case 72960 ... 72966: return &unique_character_groups[14];
-            case 72968 ... 72969: return &unique_character_groups[14];
-            case 72971 ... 73008: return &unique_character_groups[14];
-            case 73009 ... 73014: return &unique_character_groups[21];
-            case 73018: return &unique_character_groups[21];
-            case 73020 ... 73021: return &unique_character_groups[21];
-            case 73023 ... 73029: return &unique_character_groups[21];
-            case 73030: return &unique_character_groups[14];
-            case 73031: return &unique_character_groups[21];
-            case 73040 ... 73049: return &unique_character_groups[8];
-            case 73056 ... 73061: return &unique_character_groups[14];
-            case 73063 ... 73064: return &unique_character_groups[14];
-            case 73066 ... 73097: return &unique_character_groups[14];
-            case 73098 ... 73102: return &unique_character_groups[23];
-            case 73104 ... 73105: return &unique_character_groups[21];
-            case 73107 ... 73108: return &unique_character_groups[23];
-            case 73109: return &unique_character_groups[21];
-            case 73110: return &unique_character_groups[23];
-            case 73111: return &unique_character_groups[21];
-            case 73112: return &unique_character_groups[14];
-            case 73120 ... 73129: return &unique_character_groups[8];
-            case 73440 ... 73458: return &unique_character_groups[14];
-            case 73459 ... 73460: return &unique_character_groups[21];
-            case 73461 ... 73462: return &unique_character_groups[23];
-            case 73463 ... 73464: return &unique_character_groups[2];
-            case 73728 ... 74649: return &unique_character_groups[14];
-            case 74752 ... 74862: return &unique_character_groups[24];
-            case 74864 ... 74868: return &unique_character_groups[2];
-            case 74880 ... 75075: return &unique_character_groups[14];
-            case 77824 ... 78894: return &unique_character_groups[14];
-            case 82944 ... 83526: return &unique_character_groups[14];
-            case 92160 ... 92728: return &unique_character_groups[14];
-            case 92736 ... 92766: return &unique_character_groups[14];
-            case 92768 ... 92777: return &unique_character_groups[8];
-            case 92782 ... 92783: return &unique_character_groups[2];
-            case 92880 ... 92909: return &unique_character_groups[14];
-            case 92912 ... 92916: return &unique_character_groups[21];
-            case 92917: return &unique_character_groups[2];
-            case 92928 ... 92975: return &unique_character_groups[14];
-            case 92976 ... 92982: return &unique_character_groups[21];
-            case 92983 ... 92987: return &unique_character_groups[2];
-            case 92988 ... 92991: return &unique_character_groups[13];
-            case 92992 ... 92995: return &unique_character_groups[20];
-            case 92996: return &unique_character_groups[2];
-            case 92997: return &unique_character_groups[13];
-            case 93008 ... 93017: return &unique_character_groups[8];
-            case 93019 ... 93025: return &unique_character_groups[17];
-            case 93027 ... 93047: return &unique_character_groups[14];
-            case 93053 ... 93071: return &unique_character_groups[14];
-            case 93760 ... 93791: return &unique_character_groups[9];
-            case 93792 ... 93823: return &unique_character_groups[12];
-            case 93824 ... 93846: return &unique_character_groups[17];
-            case 93847 ... 93850: return &unique_character_groups[2];
-            case 93952 ... 94020: return &unique_character_groups[14];
-            case 94032: return &unique_character_groups[14];
-            case 94033 ... 94078: return &unique_character_groups[23];
-            case 94095 ... 94098: return &unique_character_groups[21];
-            case 94099 ... 94111: return &unique_character_groups[20];
-            case 94176 ... 94177: return &unique_character_groups[20];
-            case 94208: return &unique_character_groups[14];
-            case 100337: return &unique_character_groups[14];
-            case 100352 ... 101106: return &unique_character_groups[14];
-            case 110592 ... 110878: return &unique_character_groups[14];
-            case 110960 ... 111355: return &unique_character_groups[14];
-            case 113664 ... 113770: return &unique_character_groups[14];
-            case 113776 ... 113788: return &unique_character_groups[14];
-            case 113792 ... 113800: return &unique_character_groups[14];
-            case 113808 ... 113817: return &unique_character_groups[14];
-            case 113820: return &unique_character_groups[13];
-            case 113821 ... 113822: return &unique_character_groups[21];
-            case 113823: return &unique_character_groups[2];
-            case 113824 ... 113827: return &unique_character_groups[16];
-            case 118784 ... 119029: return &unique_character_groups[13];
-            case 119040 ... 119078: return &unique_character_groups[13];
-            case 119081 ... 119140: return &unique_character_groups[13];
-            case 119141 ... 119142: return &unique_character_groups[23];
-            case 119143 ... 119145: return &unique_character_groups[21];
-            case 119146 ... 119148: return &unique_character_groups[13];
-            case 119149 ... 119154: return &unique_character_groups[23];
-            case 119155 ... 119162: return &unique_character_groups[16];
-            case 119163 ... 119170: return &unique_character_groups[21];
-            case 119171 ... 119172: return &unique_character_groups[13];
-            case 119173 ... 119179: return &unique_character_groups[21];
-            case 119180 ... 119209: return &unique_character_groups[13];
-            case 119210 ... 119213: return &unique_character_groups[21];
-            case 119214 ... 119272: return &unique_character_groups[13];
-            case 119296 ... 119361: return &unique_character_groups[13];
-            case 119362 ... 119364: return &unique_character_groups[21];
-            case 119365: return &unique_character_groups[13];
-            case 119520 ... 119539: return &unique_character_groups[17];
-            case 119552 ... 119638: return &unique_character_groups[13];
-            case 119648 ... 119672: return &unique_character_groups[17];
-            case 119808 ... 119833: return &unique_character_groups[9];
-            case 119834 ... 119859: return &unique_character_groups[12];
-            case 119860 ... 119885: return &unique_character_groups[9];
-            case 119886 ... 119892: return &unique_character_groups[12];
-            case 119894 ... 119911: return &unique_character_groups[12];
-            case 119912 ... 119937: return &unique_character_groups[9];
-            case 119938 ... 119963: return &unique_character_groups[12];
-            case 119964: return &unique_character_groups[9];
-            case 119966 ... 119967: return &unique_character_groups[9];
-            case 119970: return &unique_character_groups[9];
-            case 119973 ... 119974: return &unique_character_groups[9];
-            case 119977 ... 119980: return &unique_character_groups[9];
-            case 119982 ... 119989: return &unique_character_groups[9];
-            case 119990 ... 119993: return &unique_character_groups[12];
-            case 119995: return &unique_character_groups[12];
-            case 119997 ... 120003: return &unique_character_groups[12];
-            case 120005 ... 120015: return &unique_character_groups[12];
-            case 120016 ... 120041: return &unique_character_groups[9];
-            case 120042 ... 120067: return &unique_character_groups[12];
-            case 120068 ... 120069: return &unique_character_groups[9];
-            case 120071 ... 120074: return &unique_character_groups[9];
-            case 120077 ... 120084: return &unique_character_groups[9];
-            case 120086 ... 120092: return &unique_character_groups[9];
-            case 120094 ... 120119: return &unique_character_groups[12];
-            case 120120 ... 120121: return &unique_character_groups[9];
-            case 120123 ... 120126: return &unique_character_groups[9];
-            case 120128 ... 120132: return &unique_character_groups[9];
-            case 120134: return &unique_character_groups[9];
-            case 120138 ... 120144: return &unique_character_groups[9];
-            case 120146 ... 120171: return &unique_character_groups[12];
-            case 120172 ... 120197: return &unique_character_groups[9];
-            case 120198 ... 120223: return &unique_character_groups[12];
-            case 120224 ... 120249: return &unique_character_groups[9];
-            case 120250 ... 120275: return &unique_character_groups[12];
-            case 120276 ... 120301: return &unique_character_groups[9];
-            case 120302 ... 120327: return &unique_character_groups[12];
-            case 120328 ... 120353: return &unique_character_groups[9];
-            case 120354 ... 120379: return &unique_character_groups[12];
-            case 120380 ... 120405: return &unique_character_groups[9];
-            case 120406 ... 120431: return &unique_character_groups[12];
-            case 120432 ... 120457: return &unique_character_groups[9];
-            case 120458 ... 120485: return &unique_character_groups[12];
-            case 120488 ... 120512: return &unique_character_groups[9];
-            case 120513: return &unique_character_groups[6];
-            case 120514 ... 120538: return &unique_character_groups[12];
-            case 120539: return &unique_character_groups[6];
-            case 120540 ... 120545: return &unique_character_groups[12];
-            case 120546 ... 120570: return &unique_character_groups[9];
-            case 120571: return &unique_character_groups[6];
-            case 120572 ... 120596: return &unique_character_groups[12];
-            case 120597: return &unique_character_groups[6];
-            case 120598 ... 120603: return &unique_character_groups[12];
-            case 120604 ... 120628: return &unique_character_groups[9];
-            case 120629: return &unique_character_groups[6];
-            case 120630 ... 120654: return &unique_character_groups[12];
-            case 120655: return &unique_character_groups[6];
-            case 120656 ... 120661: return &unique_character_groups[12];
-            case 120662 ... 120686: return &unique_character_groups[9];
-            case 120687: return &unique_character_groups[6];
-            case 120688 ... 120712: return &unique_character_groups[12];
-            case 120713: return &unique_character_groups[6];
-            case 120714 ... 120719: return &unique_character_groups[12];
-            case 120720 ... 120744: return &unique_character_groups[9];
-            case 120745: return &unique_character_groups[6];
-            case 120746 ... 120770: return &unique_character_groups[12];
-            case 120771: return &unique_character_groups[6];
-            case 120772 ... 120777: return &unique_character_groups[12];
-            case 120778: return &unique_character_groups[9];
-            case 120779: return &unique_character_groups[12];
-            case 120782 ... 120831: return &unique_character_groups[8];
-            case 120832 ... 121343: return &unique_character_groups[13];
-            case 121344 ... 121398: return &unique_character_groups[21];
-            case 121399 ... 121402: return &unique_character_groups[13];
-            case 121403 ... 121452: return &unique_character_groups[21];
-            case 121453 ... 121460: return &unique_character_groups[13];
-            case 121461: return &unique_character_groups[21];
-            case 121462 ... 121475: return &unique_character_groups[13];
-            case 121476: return &unique_character_groups[21];
-            case 121477 ... 121478: return &unique_character_groups[13];
-            case 121479 ... 121483: return &unique_character_groups[2];
-            case 121499 ... 121503: return &unique_character_groups[21];
-            case 121505 ... 121519: return &unique_character_groups[21];
-            case 122880 ... 122886: return &unique_character_groups[21];
-            case 122888 ... 122904: return &unique_character_groups[21];
-            case 122907 ... 122913: return &unique_character_groups[21];
-            case 122915 ... 122916: return &unique_character_groups[21];
-            case 122918 ... 122922: return &unique_character_groups[21];
-            case 124928 ... 125124: return &unique_character_groups[14];
-            case 125127 ... 125135: return &unique_character_groups[17];
-            case 125136 ... 125142: return &unique_character_groups[21];
-            case 125184 ... 125217: return &unique_character_groups[9];
-            case 125218 ... 125251: return &unique_character_groups[12];
-            case 125252 ... 125258: return &unique_character_groups[21];
-            case 125264 ... 125273: return &unique_character_groups[8];
-            case 125278 ... 125279: return &unique_character_groups[2];
-            case 126065 ... 126123: return &unique_character_groups[17];
-            case 126124: return &unique_character_groups[13];
-            case 126125 ... 126127: return &unique_character_groups[17];
-            case 126128: return &unique_character_groups[3];
-            case 126129 ... 126132: return &unique_character_groups[17];
-            case 126464 ... 126467: return &unique_character_groups[14];
-            case 126469 ... 126495: return &unique_character_groups[14];
-            case 126497 ... 126498: return &unique_character_groups[14];
-            case 126500: return &unique_character_groups[14];
-            case 126503: return &unique_character_groups[14];
-            case 126505 ... 126514: return &unique_character_groups[14];
-            case 126516 ... 126519: return &unique_character_groups[14];
-            case 126521: return &unique_character_groups[14];
-            case 126523: return &unique_character_groups[14];
-            case 126530: return &unique_character_groups[14];
-            case 126535: return &unique_character_groups[14];
-            case 126537: return &unique_character_groups[14];
-            case 126539: return &unique_character_groups[14];
-            case 126541 ... 126543: return &unique_character_groups[14];
-            case 126545 ... 126546: return &unique_character_groups[14];
-            case 126548: return &unique_character_groups[14];
-            case 126551: return &unique_character_groups[14];
-            case 126553: return &unique_character_groups[14];
-            case 126555: return &unique_character_groups[14];
-            case 126557: return &unique_character_groups[14];
-            case 126559: return &unique_character_groups[14];
-            case 126561 ... 126562: return &unique_character_groups[14];
-            case 126564: return &unique_character_groups[14];
-            case 126567 ... 126570: return &unique_character_groups[14];
-            case 126572 ... 126578: return &unique_character_groups[14];
-            case 126580 ... 126583: return &unique_character_groups[14];
-            case 126585 ... 126588: return &unique_character_groups[14];
-            case 126590: return &unique_character_groups[14];
-            case 126592 ... 126601: return &unique_character_groups[14];
-            case 126603 ... 126619: return &unique_character_groups[14];
-            case 126625 ... 126627: return &unique_character_groups[14];
-            case 126629 ... 126633: return &unique_character_groups[14];
-            case 126635 ... 126651: return &unique_character_groups[14];
-            case 126704 ... 126705: return &unique_character_groups[6];
-            case 126976 ... 127019: return &unique_character_groups[13];
-            case 127024 ... 127123: return &unique_character_groups[13];
-            case 127136 ... 127150: return &unique_character_groups[13];
-            case 127153 ... 127167: return &unique_character_groups[13];
-            case 127169 ... 127183: return &unique_character_groups[13];
-            case 127185 ... 127221: return &unique_character_groups[13];
-            case 127232 ... 127244: return &unique_character_groups[17];
-            case 127248 ... 127339: return &unique_character_groups[13];
-            case 127344 ... 127404: return &unique_character_groups[13];
-            case 127462 ... 127490: return &unique_character_groups[13];
-            case 127504 ... 127547: return &unique_character_groups[13];
-            case 127552 ... 127560: return &unique_character_groups[13];
-            case 127568 ... 127569: return &unique_character_groups[13];
-            case 127584 ... 127589: return &unique_character_groups[13];
-            case 127744 ... 127994: return &unique_character_groups[13];
-            case 127995 ... 127999: return &unique_character_groups[10];
-            case 128000 ... 128724: return &unique_character_groups[13];
-            case 128736 ... 128748: return &unique_character_groups[13];
-            case 128752 ... 128761: return &unique_character_groups[13];
-            case 128768 ... 128883: return &unique_character_groups[13];
-            case 128896 ... 128984: return &unique_character_groups[13];
-            case 129024 ... 129035: return &unique_character_groups[13];
-            case 129040 ... 129095: return &unique_character_groups[13];
-            case 129104 ... 129113: return &unique_character_groups[13];
-            case 129120 ... 129159: return &unique_character_groups[13];
-            case 129168 ... 129197: return &unique_character_groups[13];
-            case 129280 ... 129291: return &unique_character_groups[13];
-            case 129296 ... 129342: return &unique_character_groups[13];
-            case 129344 ... 129392: return &unique_character_groups[13];
-            case 129395 ... 129398: return &unique_character_groups[13];
-            case 129402: return &unique_character_groups[13];
-            case 129404 ... 129442: return &unique_character_groups[13];
-            case 129456 ... 129465: return &unique_character_groups[13];
-            case 129472 ... 129474: return &unique_character_groups[13];
-            case 129488 ... 129535: return &unique_character_groups[13];
-            case 129632 ... 129645: return &unique_character_groups[13];
-            case 131072: return &unique_character_groups[14];
-            case 173782: return &unique_character_groups[14];
-            case 173824: return &unique_character_groups[14];
-            case 177972: return &unique_character_groups[14];
-            case 177984: return &unique_character_groups[14];
-            case 178205: return &unique_character_groups[14];
-            case 178208: return &unique_character_groups[14];
-            case 183969: return &unique_character_groups[14];
-            case 183984: return &unique_character_groups[14];
-            case 191456: return &unique_character_groups[14];
-            case 194560 ... 195101: return &unique_character_groups[14];
-            case 917505: return &unique_character_groups[16];
-            case 917536 ... 917631: return &unique_character_groups[16];
-            case 917760 ... 917999: return &unique_character_groups[21];
-            case 983040: return &unique_character_groups[29];
-            case 1048573: return &unique_character_groups[29];
-            case 1048576: return &unique_character_groups[29];
-            case 1114109: return &unique_character_groups[29];
-            default: return unknown_char;
-        }
-    }
+        // Vectors of ASCII code points are lowercased at once by setting the case bit of A-Z. Vectors with any other
+        // code point go through the case folding table.
+#if defined(__AVX2__)
+        const __m256i before_upper_256 = _mm256_set1_epi32(L'A' - 1);
+        const __m256i after_upper_256 = _mm256_set1_epi32(L'Z' + 1);
+        const __m256i last_ascii_256 = _mm256_set1_epi32(0x7F);
+        const __m256i case_bit_256 = _mm256_set1_epi32(0x20);
 
-    void preserve_case(wchar_t &code) {};
+        for(; c + 8 <= end; c += 8) {
+            __m256i *chars_ptr = reinterpret_cast< __m256i * >(c);
+            const __m256i chars = _mm256_loadu_si256(chars_ptr);
 
-    void to_lowercase(wchar_t &code) {
-#if UNICODE_DEBUG
-        IPROF_FUNC;
+            if(_mm256_movemask_epi8(_mm256_cmpgt_epi32(chars, last_ascii_256)) != 0) {
+                for(wchar_t* k = c; k < c + 8; ++k) *k = fold_case(*k);
+                continue;
+            }
+
+            const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi32(chars, before_upper_256), _mm256_cmpgt_epi32(after_upper_256, chars));
+            _mm256_storeu_si256(chars_ptr, _mm256_or_si256(chars, _mm256_and_si256(upper, case_bit_256)));
+        }
 #endif
-        // Make odd codes negative and keep even codes positive.
-        switch(-code * (code % 2) + code * (code % 2 == 0)) {
-            case -125217 ... -125185: code += 34; break;
-            case -93791 ... -93761: code += 32; break;
-            case -71871 ... -71841: code += 32; break;
-            case -68785 ... -68737: code += 64; break;
-            case -66771 ... -66737: code += 40; break;
-            case -66599 ... -66561: code += 40; break;
-            case -65337 ... -65313: code += 32; break;
-            case -43967 ... -43889: code -= 38864; break;
-            case -42931: code += 928; break;
-            case -42929: code -= 42282; break;
-            case -42925: code -= 42305; break;
-            case -42923: code -= 42319; break;
-            case -42893: code -= 42280; break;
-            case -42891: code += 1; break;
-            case -42877: code -= 35332; break;
-            case -42875 ... -42873: code += 1; break;
-            case -11501 ... -11499: code += 1; break;
-            case -11391: code -= 10815; break;
-            case -11381: code += 1; break;
-            case -11375: code -= 10783; break;
-            case -11373: code -= 10780; break;
-            case -11371 ... -11367: code += 1; break;
-            case -11363: code -= 3814; break;
-            case -11309 ... -11265: code += 48; break;
-            case -9423 ... -9399: code += 26; break;
-            case -8579: code += 1; break;
-            case -8559 ... -8545: code += 16; break;
-            case -8491: code -= 8262; break;
-            case -8187: code -= 126; break;
-            case -8185: code -= 128; break;
-            case -8171: code -= 112; break;
-            case -8169: code -= 8; break;
-            case -8155: code -= 100; break;
-            case -8153: code -= 8; break;
-            case -8139 ... -8137: code -= 86; break;
-            case -8123: code -= 74; break;
-            case -8121: code -= 8; break;
-            case -8111 ... -8105: code -= 8; break;
-            case -8095 ... -8089: code -= 8; break;
-            case -8079 ... -8073: code -= 8; break;
-            case -8047 ... -8041: code -= 8; break;
-            case -8031 ... -8025: code -= 8; break;
-            case -8013 ... -8009: code -= 8; break;
-            case -7999 ... -7993: code -= 8; break;
-            case -7983 ... -7977: code -= 8; break;
-            case -7965 ... -7961: code -= 8; break;
-            case -7951 ... -7945: code -= 8; break;
-            case -7835: code -= 58; break;
-            case -7359 ... -7357: code -= 3008; break;
-            case -7353 ... -7313: code -= 3008; break;
-            case -7303: code -= 6180; break;
-            case -7301: code -= 6211; break;
-            case -7299: code -= 6210; break;
-            case -7297: code -= 6221; break;
-            case -5117 ... -5113: code -= 8; break;
-            case -4301: code += 7264; break;
-            case -4295 ... -4257: code += 7264; break;
-            case -1365 ... -1329: code += 48; break;
-            case -1229 ... -1217: code += 1; break;
-            case -1071 ... -1041: code += 32; break;
-            case -1039 ... -1025: code += 80; break;
-            case -1023 ... -1021: code -= 130; break;
-            case -1017: code -= 7; break;
-            case -1015: code += 1; break;
-            case -1013: code -= 64; break;
-            case -1009: code -= 48; break;
-            case -981: code -= 15; break;
-            case -977: code -= 25; break;
-            case -975: code += 8; break;
-            case -939 ... -913: code += 32; break;
-            case -911: code += 63; break;
-            case -905: code += 37; break;
-            case -895: code += 116; break;
-            case -837: code += 116; break;
-            case -581: code += 71; break;
-            case -579: code -= 195; break;
-            case -577: code += 1; break;
-            case -573: code -= 163; break;
-            case -571: code += 1; break;
-            case -503: code -= 56; break;
-            case -497: code += 2; break;
-            case -475 ... -459: code += 1; break;
-            case -455: code += 2; break;
-            case -453: code += 1; break;
-            case -439: code += 219; break;
-            case -437 ... -435: code += 1; break;
-            case -433: code += 217; break;
-            case -431: code += 1; break;
-            case -425: code += 218; break;
-            case -423: code += 1; break;
-            case -415: code += 214; break;
-            case -413: code += 213; break;
-            case -407: code += 209; break;
-            case -403: code += 205; break;
-            case -401: code += 1; break;
-            case -399: code += 202; break;
-            case -395: code += 1; break;
-            case -393: code += 205; break;
-            case -391: code += 1; break;
-            case -385: code += 210; break;
-            case -383: code -= 268; break;
-            case -381 ... -377: code += 1; break;
-            case -327 ... -313: code += 1; break;
-            case -221 ... -217: code += 32; break;
-            case -213 ... -193: code += 32; break;
-            case -181: code += 775; break;
-            case -89 ... -65: code += 32; break;
-            case 66 ... 90: code += 32; break;
-            case 192 ... 222: code += 32; break;
-            case 256 ... 302: code += 1; break;
-            case 306 ... 310: code += 1; break;
-            case 330 ... 374: code += 1; break;
-            case 376: code -= 121; break;
-            case 386 ... 388: code += 1; break;
-            case 390: code += 206; break;
-            case 394: code += 205; break;
-            case 398: code += 79; break;
-            case 400: code += 203; break;
-            case 404: code += 207; break;
-            case 406: code += 211; break;
-            case 408: code += 1; break;
-            case 412: code += 211; break;
-            case 416 ... 420: code += 1; break;
-            case 422: code += 218; break;
-            case 428: code += 1; break;
-            case 430: code += 218; break;
-            case 434: code += 217; break;
-            case 440: code += 1; break;
-            case 444: code += 1; break;
-            case 452: code += 2; break;
-            case 456: code += 1; break;
-            case 458: code += 2; break;
-            case 478 ... 494: code += 1; break;
-            case 498 ... 500: code += 1; break;
-            case 502: code -= 97; break;
-            case 504 ... 542: code += 1; break;
-            case 544: code -= 130; break;
-            case 546 ... 562: code += 1; break;
-            case 570: code += 10795; break;
-            case 574: code += 10792; break;
-            case 580: code += 69; break;
-            case 582 ... 590: code += 1; break;
-            case 880 ... 882: code += 1; break;
-            case 886: code += 1; break;
-            case 902: code += 38; break;
-            case 904 ... 906: code += 37; break;
-            case 908: code += 64; break;
-            case 910: code += 63; break;
-            case 914 ... 928: code += 32; break;
-            case 932 ... 938: code += 32; break;
-            case 962: code += 1; break;
-            case 976: code -= 30; break;
-            case 982: code -= 22; break;
-            case 984 ... 1006: code += 1; break;
-            case 1008: code -= 54; break;
-            case 1012: code -= 60; break;
-            case 1018: code += 1; break;
-            case 1022: code -= 130; break;
-            case 1024 ... 1038: code += 80; break;
-            case 1040 ... 1070: code += 32; break;
-            case 1120 ... 1152: code += 1; break;
-            case 1162 ... 1214: code += 1; break;
-            case 1216: code += 15; break;
-            case 1232 ... 1326: code += 1; break;
-            case 1330 ... 1366: code += 48; break;
-            case 4256 ... 4292: code += 7264; break;
-            case 5112 ... 5116: code -= 8; break;
-            case 7296: code -= 6222; break;
-            case 7298: code -= 6212; break;
-            case 7300: code -= 6210; break;
-            case 7302: code -= 6204; break;
-            case 7304: code += 35267; break;
-            case 7312 ... 7354: code -= 3008; break;
-            case 7358: code -= 3008; break;
-            case 7680 ... 7828: code += 1; break;
-            case 7838: code -= 7615; break;
-            case 7840 ... 7934: code += 1; break;
-            case 7944 ... 7950: code -= 8; break;
-            case 7960 ... 7964: code -= 8; break;
-            case 7976 ... 7982: code -= 8; break;
-            case 7992 ... 7998: code -= 8; break;
-            case 8008 ... 8012: code -= 8; break;
-            case 8040 ... 8046: code -= 8; break;
-            case 8072 ... 8078: code -= 8; break;
-            case 8088 ... 8094: code -= 8; break;
-            case 8104 ... 8110: code -= 8; break;
-            case 8120: code -= 8; break;
-            case 8122: code -= 74; break;
-            case 8124: code -= 9; break;
-            case 8126: code -= 7173; break;
-            case 8136 ... 8138: code -= 86; break;
-            case 8140: code -= 9; break;
-            case 8152: code -= 8; break;
-            case 8154: code -= 100; break;
-            case 8168: code -= 8; break;
-            case 8170: code -= 112; break;
-            case 8172: code -= 7; break;
-            case 8184: code -= 128; break;
-            case 8186: code -= 126; break;
-            case 8188: code -= 9; break;
-            case 8486: code -= 7517; break;
-            case 8490: code -= 8383; break;
-            case 8498: code += 28; break;
-            case 8544 ... 8558: code += 16; break;
-            case 9398 ... 9422: code += 26; break;
-            case 11264 ... 11310: code += 48; break;
-            case 11360: code += 1; break;
-            case 11362: code -= 10743; break;
-            case 11364: code -= 10727; break;
-            case 11374: code -= 10749; break;
-            case 11376: code -= 10782; break;
-            case 11378: code += 1; break;
-            case 11390: code -= 10815; break;
-            case 11392 ... 11490: code += 1; break;
-            case 11506: code += 1; break;
-            case 42560 ... 42604: code += 1; break;
-            case 42624 ... 42650: code += 1; break;
-            case 42786 ... 42798: code += 1; break;
-            case 42802 ... 42862: code += 1; break;
-            case 42878 ... 42886: code += 1; break;
-            case 42896 ... 42898: code += 1; break;
-            case 42902 ... 42920: code += 1; break;
-            case 42922: code -= 42308; break;
-            case 42924: code -= 42315; break;
-            case 42926: code -= 42308; break;
-            case 42928: code -= 42258; break;
-            case 42930: code -= 42261; break;
-            case 42932 ... 42936: code += 1; break;
-            case 43888 ... 43966: code -= 38864; break;
-            case 65314 ... 65338: code += 32; break;
-            case 66560 ... 66598: code += 40; break;
-            case 66736 ... 66770: code += 40; break;
-            case 68736 ... 68786: code += 64; break;
-            case 71840 ... 71870: code += 32; break;
-            case 93760 ... 93790: code += 32; break;
-            case 125184 ... 125216: code += 34; break;
+#if defined(__SSE2__)
+        const __m128i before_upper = _mm_set1_epi32(L'A' - 1);
+        const __m128i after_upper = _mm_set1_epi32(L'Z' + 1);
+        const __m128i last_ascii = _mm_set1_epi32(0x7F);
+        const __m128i case_bit = _mm_set1_epi32(0x20);
+
+        for(; c + 4 <= end; c += 4) {
+            __m128i *chars_ptr = reinterpret_cast< __m128i * >(c);
+            const __m128i chars = _mm_loadu_si128(chars_ptr);
+
+            if(_mm_movemask_epi8(_mm_cmpgt_epi32(chars, last_ascii)) != 0) {
+                for(wchar_t* k = c; k < c + 4; ++k) *k = fold_case(*k);
+                continue;
+            }
+
+            const __m128i upper = _mm_and_si128(_mm_cmpgt_epi32(chars, before_upper), _mm_cmplt_epi32(chars, after_upper));
+            _mm_storeu_si128(chars_ptr, _mm_or_si128(chars, _mm_and_si128(upper, case_bit)));
         }
+#endif
+        for(; c < end; ++c) *c = fold_case(*c);
     }
 
     void debug_unicode_data(const UnicodeData *unicode_data) {
@@ -6,6 +6,10 @@
 
 #include <iostream>
 #include <map>
+#include <cstdint>
+
+#include "general_category_table.h"
+#include "case_table.h"
 
 #if UNICODE_DEBUG
 #include "iprof.hpp"
@@ -117,15 +121,28 @@ namespace txtlib {
         { GeneralCategory::Co }
     };
 
-    const static UnicodeData* ascii_chars[] = {&unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[1], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[3], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[4], &unique_character_groups[5], &unique_character_groups[2], &unique_character_groups[6], &unique_character_groups[2], &unique_character_groups[7], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[8], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[6], &unique_character_groups[6], &unique_character_groups[6], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[4], &unique_character_groups[2], &unique_character_groups[5], &unique_character_groups[10], &unique_character_groups[11], &unique_character_groups[10], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[4], &unique_character_groups[6], &unique_character_groups[5], &unique_character_groups[6], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[0], &unique_character_groups[1], &unique_character_groups[2], &unique_character_groups[3], &unique_character_groups[3], &unique_character_groups[3], &unique_character_groups[3], &unique_character_groups[13], &unique_character_groups[2], &unique_character_groups[10], &unique_character_groups[13], &unique_character_groups[14], &unique_character_groups[15], &unique_character_groups[6], &unique_character_groups[16], &unique_character_groups[13], &unique_character_groups[10], &unique_character_groups[13], &unique_character_groups[6], &unique_character_groups[17], &unique_character_groups[17], &unique_character_groups[10], &unique_character_groups[12], &unique_character_groups[2], &unique_character_groups[2], &unique_character_groups[10], &unique_character_groups[17], &unique_character_groups[14], &unique_character_groups[18], &unique_character_groups[17], &unique_character_groups[17], &unique_character_groups[17], &unique_character_groups[2], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[6], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[9], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[6], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12], &unique_character_groups[12]};
 
     const static UnicodeData* unknown_char = &unique_character_groups[27];
 
-    const UnicodeData* find_character(const wchar_t &code);
+    inline const UnicodeData* find_character(const wchar_t &code) {
+#if UNICODE_DEBUG
+        IPROF_FUNC;
+#endif
+        if(static_cast< uint32_t >(code) > 0x10FFFF) return unknown_char;
+
+        return &unique_character_groups[general_category::lookup(static_cast< uint32_t >(code))];
+    }
+
+    // Simple (one to one) case folding of a code point, which lowercases it and folds variants like the final sigma.
+    inline wchar_t fold_case(wchar_t code) {
+        if(static_cast< uint32_t >(code) < 0x80) return code | ((code >= L'A' and code <= L'Z') << 5);
+        if(static_cast< uint32_t >(code) > 0x10FFFF) return code;
+
+        return code + case_folding::delta(static_cast< uint32_t >(code));
+    }
 
-    // Casing functions.
-    void preserve_case(wchar_t &code);
-    void to_lowercase(wchar_t &code);
+    // Lowercases (simple case folding) the code points of a token in place.
+    void to_lowercase(wchar_t* begin, wchar_t* end);
 
     void debug_unicode_data(const UnicodeData *unicode_data);
 }
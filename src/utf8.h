@@ -4,12 +4,57 @@
 #include <Rcpp.h>
 #include "mutable_string_view.h"
 #include <string>
+#include <cstring>
+#include <cstdint>
 #include <codecvt>
 #include <locale>
+#include <vector>
 #include <unicode/utf.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace txtlib {
 
+// Read-only view over UTF-8 text owned elsewhere (e.g. by an R CHARSXP). Cheap to copy and safe to share with worker
+// threads as long as the owner outlives them.
+struct utf8_text_view {
+    const char* data;
+    size_t length;
+
+    utf8_text_view() : data(""), length(0) {};
+    utf8_text_view(const char* _data, size_t _length) : data(_data), length(_length) {};
+    utf8_text_view(const std::string &str) : data(str.data()), length(str.size()) {};
+
+    size_t size() const { return this->length; }
+    bool empty() const { return this->length == 0; }
+};
+
+typedef std::vector< utf8_text_view > texts_t;
+
+// Views the elements of a character vector in place. Must run on the main thread, as it may ask R to translate
+// non UTF-8 strings. NA elements are viewed as empty texts.
+inline texts_t as_text_views(SEXP texts) {
+    const R_xlen_t n = Rf_xlength(texts);
+    texts_t views(n);
+
+    for(R_xlen_t i = 0; i < n; ++i) {
+        SEXP text = STRING_ELT(texts, i);
+
+        if(text == NA_STRING) continue;
+
+        if(Rf_getCharCE(text) == CE_LATIN1) {
+            const char* translated = Rf_translateCharUTF8(text);
+            views[i] = utf8_text_view(translated, std::strlen(translated));
+        } else {
+            views[i] = utf8_text_view(CHAR(text), LENGTH(text));
+        }
+    }
+
+    return views;
+}
+
 template< class wstring_t = std::wstring >
 inline wstring_t to_ws_icu(const char* str, size_t length) {
     using char_t = typename wstring_t::value_type;
@@ -30,6 +75,88 @@ inline wstring_t to_ws_icu(const char* str, size_t length) {
     return w;
 }
 
+// Widens the ASCII run starting at str[i] into out[o], advancing both indexes. Stops at the first non-ASCII byte or
+// when less than a full vector of input is left, so callers must finish the tail themselves. SSE2 is part of every
+// x86-64 CPU, so the vectorized path doesn't need any compiler flag or runtime dispatch.
+template< class char_t >
+inline void widen_ascii_run(const char* str, size_t length, size_t &i, char_t* out, size_t &o) {
+#if defined(__SSE2__)
+    if(sizeof(char_t) == 4) {
+        const __m128i zero = _mm_setzero_si128();
+
+        while(i + 16 <= length) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i));
+            if(_mm_movemask_epi8(bytes) != 0) return;
+
+            const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            __m128i *dst = reinterpret_cast<__m128i *>(out + o);
+
+            _mm_storeu_si128(dst, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+
+            i += 16;
+            o += 16;
+        }
+        return;
+    }
+#endif
+    // Scalar fallback: 8 bytes at a time while they're all ASCII.
+    while(i + 8 <= length) {
+        uint64_t word;
+        std::memcpy(&word, str + i, sizeof(word));
+        if(word & 0x8080808080808080ULL) return;
+
+        for(size_t k = 0; k < 8; ++k) out[o + k] = static_cast< char_t >(str[i + k]);
+
+        i += 8;
+        o += 8;
+    }
+}
+
+// Decodes a UTF-8 buffer into code points, writing at most `length` elements to out and returning how many were
+// written. ASCII runs are widened a vector at a time, everything else goes through ICU's U8_NEXT so ill-formed
+// sequences decode to U_SENTINEL exactly as in to_ws_icu.
+template< class char_t >
+inline size_t decode_utf8(const char* str, size_t length, char_t* out) {
+    size_t i = 0, o = 0;
+    UChar32 u32_char = 0;
+
+    while(i < length) {
+        widen_ascii_run(str, length, i, out, o);
+
+        // Decode until the next ASCII byte (or the end of a short tail) and go back to the fast path.
+        while(i < length) {
+            const uint8_t byte = static_cast< uint8_t >(str[i]);
+
+            if(byte < 0x80) {
+                out[o++] = static_cast< char_t >(byte);
+                i++;
+                if(i + 16 <= length) break;
+            } else {
+                int32_t offset = static_cast< int32_t >(i);
+                U8_NEXT(str, offset, static_cast< int32_t >(length), u32_char);
+                i = static_cast< size_t >(offset);
+                out[o++] = static_cast< char_t >(u32_char);
+            }
+        }
+    }
+
+    return o;
+}
+
+template< class wstring_t = std::wstring >
+inline wstring_t to_ws_simd(const char* str, size_t length) {
+    // A UTF-8 string never has more code points than bytes.
+    wstring_t w(length, 0);
+
+    if(length > 0) w.resize(decode_utf8(str, length, &w[0]));
+
+    return w;
+}
+
 template< class wstring_t = std::wstring >
 inline wstring_t to_ws(const char* str, size_t length) {
     using char_t = typename wstring_t::value_type;
@@ -44,27 +171,61 @@ inline wstring_t to_ws(const char* str, size_t length) {
 
 
 inline std::wstring utf8_to_ws(const char* c, size_t len) {
-    return to_ws_icu(c, len);
+    return to_ws_simd(c, len);
 }
 
 inline std::wstring utf8_to_ws(const std::string &utf8) {
-    return to_ws_icu(utf8.c_str(), utf8.size());
+    return to_ws_simd(utf8.c_str(), utf8.size());
 }
 
 inline std::wstring utf8_to_ws(const Rcpp::String& s) {
     char* str = (char *)(s.get_cstring());
     size_t str_len = LENGTH(s.get_sexp());
-    return to_ws_icu(str, str_len);
+    return to_ws_simd(str, str_len);
 }
 
 
+// Appends the UTF-8 encoding of [begin, end) to out. Code points that can't be encoded (surrogates, values above
+// U+10FFFF or the U_SENTINEL that ill-formed input decodes to) are written as U+FFFD.
+template< class char_t >
+inline void append_utf8(std::string &out, const char_t* begin, const char_t* end) {
+    const size_t initial_size = out.size();
+    out.resize(initial_size + 4 * (end - begin));
+
+    char* p = &out[0] + initial_size;
+
+    for(const char_t* c = begin; c != end; ++c) {
+        uint32_t code = static_cast< uint32_t >(*c);
+
+        if(code < 0x80) {
+            *p++ = static_cast< char >(code);
+            continue;
+        }
+
+        if(code > 0x10FFFF or (code >= 0xD800 and code <= 0xDFFF)) code = 0xFFFD;
+
+        if(code < 0x800) {
+            *p++ = static_cast< char >(0xC0 | (code >> 6));
+            *p++ = static_cast< char >(0x80 | (code & 0x3F));
+        } else if(code < 0x10000) {
+            *p++ = static_cast< char >(0xE0 | (code >> 12));
+            *p++ = static_cast< char >(0x80 | ((code >> 6) & 0x3F));
+            *p++ = static_cast< char >(0x80 | (code & 0x3F));
+        } else {
+            *p++ = static_cast< char >(0xF0 | (code >> 18));
+            *p++ = static_cast< char >(0x80 | ((code >> 12) & 0x3F));
+            *p++ = static_cast< char >(0x80 | ((code >> 6) & 0x3F));
+            *p++ = static_cast< char >(0x80 | (code & 0x3F));
+        }
+    }
+
+    out.resize(p - &out[0]);
+}
+
 template< class wstring_t >
-inline std::string to_utf8(wstring_t ws) {
-    using char_t = typename wstring_t::value_type;
-    std::wstring_convert< std::codecvt_utf8< char_t >, char_t > converter;
-    std::string utf8 = converter.to_bytes(ws.data(), ws.data() + ws.size());
-    if(converter.converted() < ws.size())
-        throw std::runtime_error("Incomplete UTF-8 conversion");
+inline std::string to_utf8(const wstring_t &ws) {
+    std::string utf8;
+    append_utf8(utf8, ws.data(), ws.data() + ws.size());
     return utf8;
 }
 
@@ -4,8 +4,12 @@
 
 #include "vectorizers.h"
 #include "ngrams.h"
+#include "token_lists.h"
 
 #include <RcppParallel.h>
+#include <numeric>
+#include <limits>
+#include <thread>
 #include <boost/algorithm/string.hpp>
 #include <boost/functional/hash.hpp>
 
@@ -22,20 +26,26 @@ UAX29Vectorizer::UAX29Vectorizer(std::vector< std::string > vocabulary,
                                  unsigned int min_term_length,
                                  uint64_t word_token_mask,
                                  uint64_t non_word_token_mask,
+                                 uint64_t word_token_type_mask,
                                  std::string casing_transformation,
                                  aliases_map_t case_sensitive_aliases,
                                  aliases_map_t case_insensitive_aliases,
                                  std::string stem_language,
-                                 std::string locale) {
+                                 std::string locale,
+                                 FeatureHasher feature_hasher) {
     this->vocabulary = vocabulary;
     this->ngrams_size = ngrams_size;
     this->min_term_length = min_term_length;
     this->word_token_mask = word_token_mask;
     this->non_word_token_mask = non_word_token_mask;
+    this->word_token_type_mask = word_token_type_mask;
     this->case_sensitive_aliases = case_sensitive_aliases;
     this->case_insensitive_aliases = case_insensitive_aliases;
     this->stem_language = stem_language;
     this->locale = locale;
+    this->feature_hasher = feature_hasher;
+
+    std::vector< uint64_t > prefix_hashes;
 
     // Populate vocabulary map.
     for(size_t idx = 0; idx < vocabulary.size(); ++idx) {
@@ -44,27 +54,29 @@ UAX29Vectorizer::UAX29Vectorizer(std::vector< std::string > vocabulary,
         std::vector< std::wstring > tokens;
         boost::split(tokens, term_string, boost::is_any_of(L"_"));
 
-        if(tokens.size() > 1) {
-            // Calculate the term hash as the txtlib::NGramView class does.
-            size_t term_hash = 0;
+        // Terms with '_' are n-grams, matched token by token.
+        std::vector< mutable_wstring_view > token_views;
+        for(std::wstring &token : tokens) token_views.push_back(mutable_wstring_view(&token[0], token.length()));
 
-            for(std::wstring &token : tokens) {
-                mutable_wstring_view term_view(&token[0], token.length());
-                term_hash ^= term_view.hash() + 0x9e3779b9 + (term_hash << 6) + (term_hash >> 2);
-            }
+        this->vocabulary_map.insert(token_views.data(), token_views.size(), idx);
 
-            // std::wcout << "term: \"" << term_string << "\", hash: " << term_hash << std::endl;
-            this->vocabulary_map[term_hash] = idx;
-        } else {
-            mutable_wstring_view term_view(&term_string[0], term_string.length());
-            // std::wcout << "term: \"" << term_view << "\", hash: " << term_view.hash() << std::endl;
-            this->vocabulary_map[term_view.hash()] = idx;
+        if(token_views.size() > 1) {
+            size_t prefix_hash = 0;
+
+            for(const mutable_wstring_view &token : token_views) {
+                ngram_hash_combine(prefix_hash, token.hash());
+                prefix_hashes.push_back(prefix_hash);
+            }
         }
     }
 
+    // The vocabulary doesn't change once the vectorizer is built.
+    this->vocabulary_map.freeze();
+    this->ngram_prefixes = PerfectHashSet(prefix_hashes);
+
     if(casing_transformation.size() > 0) {
         if(casing_transformation == "lower") {
-            this->casing_transform_function = txtlib::to_lowercase;
+            this->lowercase = true;
         } else {
             throw std::invalid_argument("invalid casing transformation: " + casing_transformation);
         }
@@ -72,6 +84,7 @@ UAX29Vectorizer::UAX29Vectorizer(std::vector< std::string > vocabulary,
 
     this->stemmer = create_stemmer_pointer(this->stem_language);
     this->parser = new UAX29Parser< mutable_wstring_view >(this->locale);
+    this->parser->classify_by_rule_status(this->word_token_type_mask != 0);
 }
 
 UAX29Vectorizer::~UAX29Vectorizer() {
@@ -80,21 +93,53 @@ UAX29Vectorizer::~UAX29Vectorizer() {
 }
 
 void UAX29Vectorizer::put_token(mutable_wstring_view &token, document_vector_t &document_vector) {
-    vocabulary_map_t::const_iterator map_item = this->vocabulary_map.find(token.hash());
-    if(map_item != this->vocabulary_map.end()) document_vector[map_item->second]++;
+    const size_t *term_index = this->vocabulary_map.find(token);
+    if(term_index != nullptr) document_vector.add(*term_index);
 }
 
 void UAX29Vectorizer::put_token(const NGramView &token, document_vector_t &document_vector) {
-    vocabulary_map_t::const_iterator map_item = this->vocabulary_map.find(token.hash());
-    if(map_item != this->vocabulary_map.end()) document_vector[map_item->second]++;
+    const size_t *term_index = this->vocabulary_map.find(token.tokens, token.size(), token.hash());
+    if(term_index != nullptr) document_vector.add(*term_index);
 }
 
 void UAX29Vectorizer::put_token(mutable_wstring_view &token, document_t &document) {
-    document.push_back(ws_to_utf8(token));
+    document.push_back(token);
 }
 
 void UAX29Vectorizer::put_token(const NGramView &token, document_t &document) {
-    document.push_back(ws_to_utf8(token.as_string()));
+    for(size_t idx = 0; idx < token.size(); idx++) {
+        if(idx > 0) document.append('_');
+        document.append(token.tokens[idx]);
+    }
+
+    document.end_token();
+}
+
+void UAX29Vectorizer::put_token(mutable_wstring_view &token, HashedDocument &document) {
+    document.term.clear();
+    append_utf8(document.term, token.begin(), token.end());
+
+    this->feature_hasher.put(document.term, document.features);
+}
+
+void UAX29Vectorizer::put_token(const NGramView &token, HashedDocument &document) {
+    document.term.clear();
+
+    for(size_t idx = 0; idx < token.size(); idx++) {
+        if(idx > 0) document.term.push_back('_');
+        append_utf8(document.term, token.tokens[idx].begin(), token.tokens[idx].end());
+    }
+
+    this->feature_hasher.put(document.term, document.features);
+}
+
+void UAX29Vectorizer::put_token(const NGramView &token, TermFrequencies &document) {
+    if(TermFrequencies::is_vocabulary_term(token.tokens, token.size())) document.add(token.tokens, token.size(), token.hash());
+}
+
+void UAX29Vectorizer::put_token(const NGramView &token, ProvisionalDocument &document) {
+    if(TermFrequencies::is_vocabulary_term(token.tokens, token.size()))
+        document.counts[document.frequencies->add(token.tokens, token.size(), token.hash())]++;
 }
 
 void UAX29Vectorizer::new_sentence(std::vector< UAX29Vectorizer::document_t > &document) {
@@ -102,78 +147,286 @@ void UAX29Vectorizer::new_sentence(std::vector< UAX29Vectorizer::document_t > &d
     document.push_back(s);
 };
 
-void UAX29Vectorizer::new_sentence(std::vector< UAX29Vectorizer::document_vector_t > &document) {
-    UAX29Vectorizer::document_vector_t s;
-    document.push_back(s);
+void UAX29Vectorizer::new_sentence(SentenceVectors &document) {
+    if(!document.empty()) document.back().finish();
+    document.push_back(DocumentVector(document.counter));
 };
 
 void UAX29Vectorizer::trim_document(std::vector< UAX29Vectorizer::document_t > &document) {
     // while(document.back().empty()) document.pop_back();
 };
 
-void UAX29Vectorizer::trim_document(std::vector< UAX29Vectorizer::document_vector_t > &document) {
+void UAX29Vectorizer::trim_document(SentenceVectors &document) {
     // while(document.back().empty()) document.pop_back();
 };
 
-std::vector< UAX29Vectorizer::document_t > UAX29Vectorizer::tokenize(const std::vector< std::string > &documents, bool parallel) {
+std::vector< UAX29Vectorizer::document_t > UAX29Vectorizer::tokenize(const texts_t &documents, bool parallel) {
     return this->process_texts< UAX29Vectorizer::document_t >(documents, parallel);
 }
 
-std::vector< std::vector < UAX29Vectorizer::document_t > > UAX29Vectorizer::tokenize_sentences(const std::vector< std::string > &documents, bool parallel) {
+std::vector< std::vector < UAX29Vectorizer::document_t > > UAX29Vectorizer::tokenize_sentences(const texts_t &documents, bool parallel) {
     return this->process_texts< std::vector < UAX29Vectorizer::document_t > >(documents, parallel);
 }
 
-std::vector< UAX29Vectorizer::document_vector_t > UAX29Vectorizer::vectorize(const std::vector< std::string > &documents, bool parallel) {
+std::vector< UAX29Vectorizer::document_vector_t > UAX29Vectorizer::vectorize(const texts_t &documents, bool parallel) {
     return this->process_texts< UAX29Vectorizer::document_vector_t >(documents, parallel);
 }
 
-std::vector< std::vector < UAX29Vectorizer::document_vector_t > > UAX29Vectorizer::vectorize_sentences(const std::vector< std::string > &documents, bool parallel) {
-    return this->process_texts< std::vector < UAX29Vectorizer::document_vector_t > >(documents, parallel);
+std::vector< SentenceVectors > UAX29Vectorizer::vectorize_sentences(const texts_t &documents, bool parallel) {
+    return this->process_texts< SentenceVectors >(documents, parallel);
+}
+
+std::vector< TokenSpans > UAX29Vectorizer::tokenize_spans(const texts_t &documents, bool parallel) {
+    return this->process_texts< TokenSpans >(documents, parallel);
+}
+
+std::vector< HashedDocument > UAX29Vectorizer::hash_vectorize(const texts_t &documents, bool parallel) {
+    return this->process_texts< HashedDocument >(documents, parallel);
+}
+
+TermFrequencies UAX29Vectorizer::count_terms(const texts_t &documents, bool parallel) {
+    TermFrequencies frequencies;
+    this->process_texts< TermFrequencies >(documents, parallel, frequencies);
+    return frequencies;
+}
+
+std::vector< size_t > TermFrequencies::select(double min_df, double max_df, size_t max_features, std::vector< std::string > &selected_terms) const {
+    std::vector< size_t > kept;
+
+    for(size_t id = 0; id < this->terms.size(); ++id) {
+        const double document_frequency = static_cast< double >(this->terms.value(id).document_frequency);
+        if(document_frequency >= min_df and document_frequency <= max_df) kept.push_back(id);
+    }
+
+    std::vector< std::string > kept_terms(kept.size());
+    for(size_t i = 0; i < kept.size(); ++i) kept_terms[i] = ws_to_utf8(this->terms.term(kept[i]));
+
+    std::vector< size_t > order(kept.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // The most frequent terms first, ties broken by term so the vocabulary doesn't depend on the order terms were seen.
+    if(max_features > 0 and max_features < kept.size()) {
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            const size_t frequency_a = this->terms.value(kept[a]).term_frequency, frequency_b = this->terms.value(kept[b]).term_frequency;
+            return frequency_a != frequency_b ? frequency_a > frequency_b : kept_terms[a] < kept_terms[b];
+        });
+
+        order.resize(max_features);
+    }
+
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return kept_terms[a] < kept_terms[b]; });
+
+    std::vector< size_t > ids(order.size());
+    selected_terms.resize(order.size());
+
+    for(size_t i = 0; i < order.size(); ++i) {
+        ids[i] = kept[order[i]];
+        selected_terms[i] = kept_terms[order[i]];
+    }
+
+    return ids;
+}
+
+std::vector< std::string > UAX29Vectorizer::fit_vocabulary(const texts_t &documents, bool parallel, double min_df, double max_df, size_t max_features) {
+    std::vector< std::string > fitted_vocabulary;
+    this->count_terms(documents, parallel).select(min_df, max_df, max_features, fitted_vocabulary);
+
+    return fitted_vocabulary;
+}
+
+// Rewrites provisional term counts as counts by vocabulary column, sorted, dropping the terms that weren't kept.
+struct ProvisionalRemapWorker : public RcppParallel::Worker {
+    std::vector< ProvisionalDocument > &provisional;
+    std::vector< UAX29Vectorizer::document_vector_t > &vectors;
+    const std::map< const TermFrequencies*, std::vector< size_t > > &columns;  // Column of each provisional id, by frequencies.
+
+    ProvisionalRemapWorker(std::vector< ProvisionalDocument > &provisional,
+                           std::vector< UAX29Vectorizer::document_vector_t > &vectors,
+                           const std::map< const TermFrequencies*, std::vector< size_t > > &columns) :
+        provisional(provisional), vectors(vectors), columns(columns) {};
+
+    void operator()(size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i) {
+            const std::vector< size_t > &document_columns = columns.at(provisional[i].frequencies);
+
+            UAX29Vectorizer::document_vector_t::counts_t &counts = vectors[i].counts;
+
+            for(const auto &item : provisional[i].counts) {
+                const size_t column = document_columns[item.first];
+                if(column != static_cast< size_t >(-1)) counts.push_back(std::make_pair(static_cast< uint32_t >(column), static_cast< uint32_t >(item.second)));
+            }
+
+            std::sort(counts.begin(), counts.end());
+
+            ProvisionalDocument::counts_t().swap(provisional[i].counts);
+        }
+    }
+};
+
+std::vector< UAX29Vectorizer::document_vector_t > UAX29Vectorizer::fit_transform(const texts_t &documents, bool parallel, double min_df, double max_df, size_t max_features,
+                                                                                  std::vector< std::string > &fitted_vocabulary) {
+    ProvisionalVectors provisional;
+    this->process_texts< ProvisionalDocument >(documents, parallel, provisional);
+
+    // Each thread's terms are merged into a single dictionary, where the vocabulary is selected.
+    TermFrequencies frequencies;
+    std::vector< std::vector< size_t > > merged_ids;
+    for(const auto &thread_frequencies : provisional.frequencies) merged_ids.push_back(frequencies.merge(*thread_frequencies));
+
+    const std::vector< size_t > selected = frequencies.select(min_df, max_df, max_features, fitted_vocabulary);
+
+    std::vector< size_t > merged_columns(frequencies.terms.size(), static_cast< size_t >(-1));
+    for(size_t column = 0; column < selected.size(); ++column) merged_columns[selected[column]] = column;
+
+    std::map< const TermFrequencies*, std::vector< size_t > > columns;
+
+    for(size_t t = 0; t < provisional.frequencies.size(); ++t) {
+        std::vector< size_t > &thread_columns = columns[provisional.frequencies[t].get()];
+        thread_columns.resize(merged_ids[t].size());
+
+        for(size_t id = 0; id < merged_ids[t].size(); ++id) thread_columns[id] = merged_columns[merged_ids[t][id]];
+    }
+
+    std::vector< UAX29Vectorizer::document_vector_t > vectors(documents.size());
+    ProvisionalRemapWorker w(provisional.documents, vectors, columns);
+
+    if(parallel) {
+        parallelFor(0, documents.size(), w, 100L);
+    } else {
+        w(0, documents.size());
+    }
+
+    return vectors;
+}
+
+template < class return_document_t, class output_t >
+void UAX29Vectorizer::process_texts(const texts_t &documents, bool parallel, output_t &output) {
+    if(this->lowercase) return this->process_texts_stemming< return_document_t, true >(documents, parallel, output);
+    return this->process_texts_stemming< return_document_t, false >(documents, parallel, output);
 }
 
-template < class return_document_t >
-std::vector< return_document_t > UAX29Vectorizer::process_texts(const std::vector< std::string > &documents, bool parallel) {
-    std::vector< return_document_t > vectors(documents.size());
+template < class return_document_t, bool lowercase, class output_t >
+void UAX29Vectorizer::process_texts_stemming(const texts_t &documents, bool parallel, output_t &output) {
+    if(this->stem_language.size() > 0) return this->process_texts_aliases< return_document_t, lowercase, true >(documents, parallel, output);
+    return this->process_texts_aliases< return_document_t, lowercase, false >(documents, parallel, output);
+}
 
+template < class return_document_t, bool lowercase, bool stemming, class output_t >
+void UAX29Vectorizer::process_texts_aliases(const texts_t &documents, bool parallel, output_t &output) {
+    if(this->case_sensitive_aliases.size() > 0 or this->case_insensitive_aliases.size() > 0)
+        return this->process_texts_ngrams< return_document_t, lowercase, stemming, true >(documents, parallel, output);
+    return this->process_texts_ngrams< return_document_t, lowercase, stemming, false >(documents, parallel, output);
+}
 
+template < class return_document_t, bool lowercase, bool stemming, bool aliases, class output_t >
+void UAX29Vectorizer::process_texts_ngrams(const texts_t &documents, bool parallel, output_t &output) {
+    if(!has_ngrams< return_document_t >::value or this->ngrams_size == 1)
+        return this->run_pipeline< return_document_t, TokenPipeline< lowercase, stemming, aliases, 1 > >(documents, parallel, output);
+    if(this->ngrams_size == 2)
+        return this->run_pipeline< return_document_t, TokenPipeline< lowercase, stemming, aliases, 2 > >(documents, parallel, output);
+    return this->run_pipeline< return_document_t, TokenPipeline< lowercase, stemming, aliases, 0 > >(documents, parallel, output);
+}
+
+template < class return_document_t, class pipeline_t >
+void UAX29Vectorizer::run_pipeline(const texts_t &documents, bool parallel, std::vector< return_document_t > &vectors) {
 #if RCPP_PARALLEL_USE_TBB
     if(!parallel) {
 #endif
 
-    NGramsGenerator< return_document_t > *ngrams_generator = this->create_ngrams_generator_pointer< return_document_t >();
+    typename ngrams_generator_type< return_document_t, pipeline_t::ngrams >::type ngrams_generator(this);
+    TermCounter counter(counts_vocabulary_terms< return_document_t >::value ? this->vocabulary.size() : 0);
 
     for(size_t idx = 0; idx < documents.size(); ++idx) {
-        vectors[idx] = this->parse_text< return_document_t >(documents[idx], *this->parser, *this->stemmer, ngrams_generator);
+        this->bind_counter(vectors[idx], counter);
+        this->parse_text< return_document_t, pipeline_t >(documents[idx], vectors[idx], *this->parser, *this->stemmer, ngrams_generator);
     }
 
-    delete ngrams_generator;
-
 #if RCPP_PARALLEL_USE_TBB
     } else {
-        UAX29Vectorizer::UAX29VectorizerWorker< return_document_t > w(documents, vectors, *this);
+        // Each thread clones the locale's break iterators once and keeps its state for all of its chunks.
+        UAX29Vectorizer::worker_states_t< return_document_t, pipeline_t > states;
+        UAX29Vectorizer::UAX29VectorizerWorker< return_document_t, pipeline_t > w(documents, vectors, *this, states);
         parallelFor(0, documents.size(), w, 100L);
     }
 #endif
+}
+
+template < class return_document_t, class pipeline_t >
+void UAX29Vectorizer::run_pipeline(const texts_t &documents, bool parallel, TermFrequencies &frequencies) {
+#if RCPP_PARALLEL_USE_TBB
+    if(!parallel) {
+#endif
+
+    typename ngrams_generator_type< TermFrequencies, pipeline_t::ngrams >::type ngrams_generator(this);
+
+    for(size_t idx = 0; idx < documents.size(); ++idx) {
+        frequencies.new_document(idx);
+        this->parse_text< TermFrequencies, pipeline_t >(documents[idx], frequencies, *this->parser, *this->stemmer, ngrams_generator);
+    }
 
-    return(vectors);
+#if RCPP_PARALLEL_USE_TBB
+    } else {
+        // Each range of texts is counted apart and the counts are merged as ranges are joined.
+        UAX29Vectorizer::worker_states_t< TermFrequencies, pipeline_t > states;
+        UAX29Vectorizer::TermFrequenciesWorker< pipeline_t > w(documents, *this, states);
+        parallelReduce(0, documents.size(), w, 100L);
+
+        frequencies = std::move(w.frequencies);
+    }
+#endif
 }
 
 
-template < class return_document_t >
-return_document_t UAX29Vectorizer::parse_text(const std::string &text,
-                                              txtlib::UAX29Parser< mutable_wstring_view > &parser,
-                                              txtlib::Stemmer &stemmer,
-                                              NGramsGenerator< return_document_t > *ngrams_generator) {
-    return_document_t doc;
+template < class return_document_t, class pipeline_t >
+void UAX29Vectorizer::run_pipeline(const texts_t &documents, bool parallel, ProvisionalVectors &vectors) {
+    vectors.documents.resize(documents.size());
+
+#if RCPP_PARALLEL_USE_TBB
+    if(!parallel) {
+#endif
+
+    vectors.frequencies.emplace_back(new TermFrequencies());
+    TermFrequencies &frequencies = *vectors.frequencies.back();
+
+    typename ngrams_generator_type< ProvisionalDocument, pipeline_t::ngrams >::type ngrams_generator(this);
+
+    for(size_t idx = 0; idx < documents.size(); ++idx) {
+        frequencies.new_document(idx);
+        vectors.documents[idx].frequencies = &frequencies;
+        this->parse_text< ProvisionalDocument, pipeline_t >(documents[idx], vectors.documents[idx], *this->parser, *this->stemmer, ngrams_generator);
+    }
+
+#if RCPP_PARALLEL_USE_TBB
+    } else {
+        // Each thread numbers the terms it sees in its own frequencies, so documents are parsed without locking.
+        UAX29Vectorizer::worker_states_t< ProvisionalDocument, pipeline_t > states;
+        tbb::enumerable_thread_specific< std::unique_ptr< TermFrequencies > > frequencies;
+
+        UAX29Vectorizer::ProvisionalVectorsWorker< pipeline_t > w(documents, vectors.documents, *this, states, frequencies);
+        parallelFor(0, documents.size(), w, 100L);
+
+        for(std::unique_ptr< TermFrequencies > &thread_frequencies : frequencies)
+            if(thread_frequencies) vectors.frequencies.push_back(std::move(thread_frequencies));
+    }
+#endif
+}
+
 
-    if(text.empty()) return doc;
+template < class return_document_t, class pipeline_t >
+void UAX29Vectorizer::parse_text(const utf8_text_view &text,
+                                 return_document_t &doc,
+                                 txtlib::UAX29Parser< mutable_wstring_view > &parser,
+                                 txtlib::Stemmer &stemmer,
+                                 typename ngrams_generator_type< return_document_t, pipeline_t::ngrams >::type &ngrams_generator) {
+    typedef typename ngrams_generator_type< return_document_t, pipeline_t::ngrams >::type ngrams_generator_t;
 
-    ngrams_generator->reset();
+    if(text.empty()) return;
 
-    std::wstring wide_string = utf8_to_ws(text);
+    // Calls are qualified with the generator's own type, so they are resolved at compile time and inlined.
+    ngrams_generator.ngrams_generator_t::reset();
 
-    mutable_wstring_view text_view(&wide_string[0], wide_string.length());
-    parser.set_str(text_view);
+    // Sentence boundaries also keep n-grams from spanning sentences, so only flat documents without n-grams skip them.
+    parser.set_utf8(text.data, text.length, has_sentences< return_document_t >::value or pipeline_t::ngrams != 1);
 
     size_t token_initial_length;
     mutable_wstring_view current_token;
@@ -183,33 +436,35 @@ return_document_t UAX29Vectorizer::parse_text(const std::string &text,
     while(parser.has_tokens()) {
         if(parser.current_token.new_sentence) {
             this->new_sentence(doc);
-            ngrams_generator->reset();
+            ngrams_generator.ngrams_generator_t::reset();
         }
 
-        current_token = parser.current_token.token;
+        if(!this->is_word_token(parser.current_token)) continue;
+
+        this->set_candidate(parser.current_token, doc);
 
-        if(current_token.empty() or !(parser.current_token.token_mask & this->word_token_mask) or parser.current_token.token_mask & this->non_word_token_mask) continue;
+        // Only tokens that survive the category masks are widened to UTF-32.
+        current_token = parser.token();
 
-        do_replacement(current_token, this->case_sensitive_aliases);
+        if(pipeline_t::aliases) do_replacement(current_token, this->case_sensitive_aliases);
 
         token_initial_length = current_token.length();
 
-        std::for_each(current_token.begin(), current_token.end(), this->casing_transform_function);
+        if(pipeline_t::lowercase) to_lowercase(current_token.begin(), current_token.end());
 
-        stemmer.stem(current_token);
+        if(pipeline_t::stemming) stemmer.stem(current_token);
 
-        do_replacement(current_token, this->case_insensitive_aliases);
+        if(pipeline_t::aliases) do_replacement(current_token, this->case_insensitive_aliases);
 
         if(current_token.length() == 0) continue;
 
         if(token_initial_length >= min_term_length) this->put_token(current_token, doc);
 
-        ngrams_generator->create_ngrams(current_token, doc);
+        ngrams_generator.ngrams_generator_t::create_ngrams(current_token, doc);
     }
 
+    this->finish_document(doc);
     // this->trim_document(doc);
-
-    return(doc);
 }
 
 }
@@ -236,11 +491,15 @@ SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary,
                                      std::string stemming_language,
                                      std::vector< std::string > word_token_categories,
                                      std::vector< std::string > non_word_token_categories,
-                                     std::string locale) {
+                                     std::vector< std::string > word_token_types,
+                                     std::string locale,
+                                     size_t n_features = 0,
+                                     uint32_t hash_seed = 0,
+                                     bool alternate_sign = false) {
     aliases_map_t case_sensitive_aliases_map = as_alias_map(case_sensitive_aliases);
     aliases_map_t case_insensitive_aliases_map = as_alias_map(case_insensitive_aliases);
 
-    uint64_t word_token_mask = 0UL, non_word_token_mask = 0UL;
+    uint64_t word_token_mask = 0UL, non_word_token_mask = 0UL, word_token_type_mask = 0UL;
 
     for(const std::string& c : word_token_categories) {
         auto e = GeneralCategoryValues.find(c);
@@ -256,6 +515,13 @@ SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary,
         non_word_token_mask |= e->second;
     }
 
+    for(const std::string& t : word_token_types) {
+        auto e = WordTokenTypeValues.find(t);
+
+        if(e == WordTokenTypeValues.end()) Rcpp::stop("Unknown word token type '" + t  + "'");
+        word_token_type_mask |= e->second;
+    }
+
     if(ignored_terms.size() > 0) {
         Stemmer* s = create_stemmer_pointer(stemming_language);
 
@@ -264,7 +530,7 @@ SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary,
             mutable_wstring_view excluded_term_view(&ignored_term[0], ignored_term.size());
 
             s->stem(excluded_term_view);
-            case_insensitive_aliases_map[excluded_term_view.hash()] = L"";
+            case_insensitive_aliases_map.insert(excluded_term_view, L"");
         }
 
         delete s;
@@ -276,69 +542,233 @@ SEXP create_uax29_vectorizer_pointer(std::vector < std::string > vocabulary,
         min_term_length,
         word_token_mask,
         non_word_token_mask,
+        word_token_type_mask,
         casing_transformation,
         case_sensitive_aliases_map,
         case_insensitive_aliases_map,
         stemming_language,
-        locale
+        locale,
+        FeatureHasher(n_features, hash_seed, alternate_sign)
     );
 
     return XPtr< txtlib::UAX29Vectorizer >(vectorizer, true);
 }
 
+// [[Rcpp::export]]
+IntegerVector term_collisions_impl(SEXP vectorizer_handle) {
+    if(!vectorizer_handle) Rcpp::stop("Null pointer");
 
-S4 UAX29Vectorizer::as_dgCMatrix(const std::vector< document_vector_t > &document_vectors, const List &dimnames) {
-    // dgCMatrix has three properties: i (row index), p (column pointer) and x (matrix values).
-    // This method borrows from Armadillo's bulk insert method init_batch_std (https://gitlab.com/conradsnicta/armadillo-code/-/blob/10.2.x/include/armadillo_bits/SpMat_meat.hpp#L5200).
-    size_t n_elem = 0;
+    XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
 
-    for(const document_vector_t &d : document_vectors) n_elem += d.size();
+    // Ignored terms are case insensitive aliases to an empty term.
+    return IntegerVector::create(
+        _["vocabulary"] = vectorizer->vocabulary_map.collisions(),
+        _["case_sensitive_aliases"] = vectorizer->case_sensitive_aliases.collisions(),
+        _["case_insensitive_aliases"] = vectorizer->case_insensitive_aliases.collisions()
+    );
+}
 
-    using namespace arma;
 
-    Mat< uword > tuples(3, n_elem);
-    uvec elem_weight(n_elem);
+// Counts the nonzero values of each column in each block of rows.
+template < class row_t >
+struct ColumnCountsWorker : public RcppParallel::Worker {
+    const std::vector< row_t > &rows;
+    const size_t n_columns, n_blocks;
+    std::vector< int > &block_columns;  // Count of block b and column j at b * n_columns + j.
 
-    size_t elem_idx = 0;
-    const size_t doc_count = document_vectors.size();
-    const size_t vocabulary_size = this->vocabulary.size();
+    ColumnCountsWorker(const std::vector< row_t > &rows, size_t n_columns, size_t n_blocks, std::vector< int > &block_columns) :
+        rows(rows), n_columns(n_columns), n_blocks(n_blocks), block_columns(block_columns) {};
 
-    for(size_t row_number = 0; row_number < doc_count; row_number++) {
-        for(const auto& elem : document_vectors[row_number]) {
-            // elem.first is the term's index in the vocabulary.
-            // elem.second is the count of a term in the document.
-            elem_weight[elem_idx] = elem.first * doc_count + row_number;
+    void operator()(size_t begin, size_t end) {
+        for(size_t block = begin; block < end; ++block) {
+            int *counts = &block_columns[block * n_columns];
 
-            tuples(0, elem_idx) = row_number;
-            tuples(1, elem_idx) = elem.first;
-            tuples(2, elem_idx) = elem.second;
+            for(size_t row = block * rows.size() / n_blocks; row < (block + 1) * rows.size() / n_blocks; ++row)
+                for(const auto &elem : rows[row])
+                    if(elem.second != 0) counts[elem.first]++;  // Hashed terms of opposite signs can cancel out.
+        }
+    }
+};
 
-            ++elem_idx;
+// Writes each block's nonzero values from its first position in each column on. Blocks hold consecutive rows and
+// are visited in order, so row indexes are sorted within columns.
+template < class row_t >
+struct ColumnScatterWorker : public RcppParallel::Worker {
+    const std::vector< row_t > &rows;
+    const size_t n_columns, n_blocks;
+    std::vector< int > &block_columns;  // Next position of block b in column j at b * n_columns + j.
+    int *i;
+    double *x;
+
+    ColumnScatterWorker(const std::vector< row_t > &rows, size_t n_columns, size_t n_blocks, std::vector< int > &block_columns, int *i, double *x) :
+        rows(rows), n_columns(n_columns), n_blocks(n_blocks), block_columns(block_columns), i(i), x(x) {};
+
+    void operator()(size_t begin, size_t end) {
+        for(size_t block = begin; block < end; ++block) {
+            int *positions = &block_columns[block * n_columns];
+
+            for(size_t row = block * rows.size() / n_blocks; row < (block + 1) * rows.size() / n_blocks; ++row) {
+                for(const auto &elem : rows[row]) {
+                    if(elem.second == 0) continue;
+
+                    const int position = positions[elem.first]++;
+                    i[position] = static_cast< int >(row);
+                    x[position] = elem.second;
+                }
+            }
         }
     }
+};
+
+template < class row_t >
+S4 UAX29Vectorizer::as_dgCMatrix(const std::vector< row_t > &rows, size_t n_columns, const List &dimnames, bool parallel) {
+    // dgCMatrix has three properties: i (row index), p (column pointer) and x (matrix values). They are filled by a
+    // counting sort of the nonzero values by column: rows are split in blocks, each block counts its values in each
+    // column, the counts are turned into the first position of each block in each column and each block writes its
+    // values there. Apart from the output, this only takes a count per block and column, so there are no more blocks
+    // than the values fill columns: the counts never take more memory than the output.
+    const size_t doc_count = rows.size();
+    size_t n_blocks = 1;
+
+    if(parallel) {
+        size_t n_values = 0;
+        for(const row_t &row : rows) n_values += row.size();
+
+        n_blocks = std::min< size_t >(doc_count / 1000, std::thread::hardware_concurrency());
+        n_blocks = std::max< size_t >(1, std::min< size_t >(n_blocks, n_values / std::max< size_t >(n_columns, 1)));
+    }
 
-    IntegerVector i(n_elem);
-    IntegerVector p(vocabulary_size + 1);
-    NumericVector x(n_elem);
+    std::vector< int > block_columns(n_blocks * n_columns, 0);
+
+    ColumnCountsWorker< row_t > counts_worker(rows, n_columns, n_blocks, block_columns);
+    if(n_blocks > 1) {
+        parallelFor(0, n_blocks, counts_worker, 1);
+    } else {
+        counts_worker(0, n_blocks);
+    }
+
+    IntegerVector p(n_columns + 1);
+    size_t n_elem = 0;
 
-    uvec elements_order = sort_index(elem_weight);
+    for(size_t column = 0; column < n_columns; ++column) {
+        for(size_t block = 0; block < n_blocks; ++block) {
+            int &count = block_columns[block * n_columns + column];
+            const size_t block_count = count;
 
-    for (arma::uword elem_idx = 0; elem_idx < n_elem; ++elem_idx) {
-        const arma::uword* tuple = tuples.colptr(elements_order[elem_idx]);
+            count = static_cast< int >(n_elem);
+            n_elem += block_count;
+        }
 
-        i[elem_idx] = tuple[0];
-        p[tuple[1] + 1]++;
-        x[elem_idx] = tuple[2];
+        if(n_elem > static_cast< size_t >(std::numeric_limits< int >::max())) Rcpp::stop("Too many nonzero values for a dgCMatrix");
+        p[column + 1] = static_cast< int >(n_elem);
     }
 
-    // Cumsum columns counts
-    std::partial_sum(p.begin(), p.end(), p.begin());
+    IntegerVector i(n_elem);
+    NumericVector x(n_elem);
+
+    ColumnScatterWorker< row_t > scatter_worker(rows, n_columns, n_blocks, block_columns, i.begin(), x.begin());
+    if(n_blocks > 1) {
+        parallelFor(0, n_blocks, scatter_worker, 1);
+    } else {
+        scatter_worker(0, n_blocks);
+    }
 
     S4 mat("dgCMatrix");
     mat.slot("i") = i;
     mat.slot("p") = p;
     mat.slot("x") = x;
-    mat.slot("Dim") = IntegerVector::create(doc_count, vocabulary_size);
+    mat.slot("Dim") = IntegerVector::create(doc_count, n_columns);
+    mat.slot("Dimnames") = dimnames;
+
+    return(mat);
+}
+
+// Counts the nonzero values of each row.
+template < class row_t >
+struct RowCountsWorker : public RcppParallel::Worker {
+    const std::vector< row_t > &rows;
+    int *row_counts;
+
+    RowCountsWorker(const std::vector< row_t > &rows, int *row_counts) : rows(rows), row_counts(row_counts) {};
+
+    void operator()(size_t begin, size_t end) {
+        for(size_t row = begin; row < end; ++row) {
+            int count = 0;
+            for(const auto &elem : rows[row]) count += elem.second != 0;
+
+            row_counts[row + 1] = count;
+        }
+    }
+};
+
+// Writes each row's nonzero values, sorted by column, from the row's offset on.
+template < class row_t >
+struct RowScatterWorker : public RcppParallel::Worker {
+    const std::vector< row_t > &rows;
+    const int *p;
+    int *j;
+    double *x;
+
+    RowScatterWorker(const std::vector< row_t > &rows, const int *p, int *j, double *x) : rows(rows), p(p), j(j), x(x) {};
+
+    void operator()(size_t begin, size_t end) {
+        std::vector< std::pair< int, double > > row_values;
+
+        for(size_t row = begin; row < end; ++row) {
+            row_values.clear();
+
+            for(const auto &elem : rows[row])
+                if(elem.second != 0) row_values.push_back(std::make_pair(static_cast< int >(elem.first), static_cast< double >(elem.second)));
+
+            std::sort(row_values.begin(), row_values.end());
+
+            for(size_t k = 0, position = p[row]; k < row_values.size(); ++k, ++position) {
+                j[position] = row_values[k].first;
+                x[position] = row_values[k].second;
+            }
+        }
+    }
+};
+
+template < class row_t >
+S4 UAX29Vectorizer::as_dgRMatrix(const std::vector< row_t > &rows, size_t n_columns, const List &dimnames, bool parallel) {
+    // dgRMatrix has three properties: j (column index), p (row pointer) and x (matrix values). Rows are documents, so
+    // once each row's offset is known every row is written on its own, sorting only its own columns.
+    const size_t doc_count = rows.size();
+
+    IntegerVector p(doc_count + 1);
+
+    RowCountsWorker< row_t > counts_worker(rows, p.begin());
+    if(parallel) {
+        parallelFor(0, doc_count, counts_worker, 1000);
+    } else {
+        counts_worker(0, doc_count);
+    }
+
+    size_t n_elem = 0;
+
+    for(size_t row = 0; row < doc_count; ++row) {
+        n_elem += p[row + 1];
+
+        if(n_elem > static_cast< size_t >(std::numeric_limits< int >::max())) Rcpp::stop("Too many nonzero values for a dgRMatrix");
+        p[row + 1] = static_cast< int >(n_elem);
+    }
+
+    IntegerVector j(n_elem);
+    NumericVector x(n_elem);
+
+    RowScatterWorker< row_t > scatter_worker(rows, p.begin(), j.begin(), x.begin());
+    if(parallel) {
+        parallelFor(0, doc_count, scatter_worker, 1000);
+    } else {
+        scatter_worker(0, doc_count);
+    }
+
+    S4 mat("dgRMatrix");
+    mat.slot("j") = j;
+    mat.slot("p") = p;
+    mat.slot("x") = x;
+    mat.slot("Dim") = IntegerVector::create(doc_count, n_columns);
     mat.slot("Dimnames") = dimnames;
 
     return(mat);
@@ -346,31 +776,162 @@ S4 UAX29Vectorizer::as_dgCMatrix(const std::vector< document_vector_t > &documen
 
 
 // [[Rcpp::export]]
-std::vector< std::vector < std::string > > tokenize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel = false) {
+List tokenize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, bool lazy = false) {
+    if(!vectorizer_handle) Rcpp::stop("Null pointer");
+
+    XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
+
+    auto docs = vectorizer->tokenize(as_text_views(texts), parallel);
+
+    if(lazy) {
+        TokenArena *arena = new TokenArena();
+
+        for(UAX29Vectorizer::document_t &doc : docs) {
+            arena->add_document(doc);
+            doc = UAX29Vectorizer::document_t();  // Release each document as soon as it's in the arena.
+        }
+
+        return as_lazy_character_vectors(arena);
+    }
+
+    List output_list(docs.size());
+
+    for(size_t i = 0; i < docs.size(); ++i) output_list[i] = as_character_vector(docs[i]);
+
+    return output_list;
+}
+
+// [[Rcpp::export]]
+List sentence_tokenize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, bool lazy = false) {
     if(!vectorizer_handle) Rcpp::stop("Null pointer");
 
     XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
 
-    return vectorizer->tokenize(texts, parallel);
+    auto docs = vectorizer->tokenize_sentences(as_text_views(texts), parallel);
+
+    List output_list(docs.size());
+
+    if(lazy) {
+        // Every sentence is a document of the arena.
+        TokenArena *arena = new TokenArena();
+
+        for(std::vector< UAX29Vectorizer::document_t > &doc : docs) {
+            for(UAX29Vectorizer::document_t &sentence : doc) {
+                arena->add_document(sentence);
+                sentence = UAX29Vectorizer::document_t();
+            }
+        }
+
+        List sentence_lists = as_lazy_character_vectors(arena);
+
+        for(size_t i = 0, sentence_idx = 0; i < docs.size(); ++i) {
+            List sentences(docs[i].size());
+
+            for(size_t j = 0; j < docs[i].size(); ++j) sentences[j] = sentence_lists[sentence_idx++];
+
+            output_list[i] = sentences;
+        }
+
+        return output_list;
+    }
+
+    for(size_t i = 0; i < docs.size(); ++i) {
+        List sentences(docs[i].size());
+
+        for(size_t j = 0; j < docs[i].size(); ++j) sentences[j] = as_character_vector(docs[i][j]);
+
+        output_list[i] = sentences;
+    }
+
+    return output_list;
 }
 
 // [[Rcpp::export]]
-std::vector< std::vector < std::vector < std::string > > > sentence_tokenize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel = false) {
+List tokenize_spans_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, bool code_points = false, bool types = false) {
     if(!vectorizer_handle) Rcpp::stop("Null pointer");
 
     XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
 
-    return vectorizer->tokenize_sentences(texts, parallel);
+    const texts_t text_views = as_text_views(texts);
+    auto docs = vectorizer->tokenize_spans(text_views, parallel);
+
+    CharacterVector names = CharacterVector::create("start", "end");
+    if(code_points) {
+        names.push_back("char_start");
+        names.push_back("char_end");
+    }
+    if(types) names.push_back("type");
+
+    const CharacterVector type_levels = CharacterVector::create("none", "number", "letter", "kana", "ideo");
+
+    List output_list(docs.size());
+
+    for(size_t i = 0; i < docs.size(); ++i) {
+        const TokenSpans &spans = docs[i];
+        const size_t n_tokens = spans.size();
+
+        // Positions are 1-based and inclusive, as substr() takes them.
+        IntegerVector start(n_tokens), end(n_tokens);
+
+        for(size_t j = 0; j < n_tokens; ++j) {
+            start[j] = spans.start[j] + 1;
+            end[j] = spans.end[j];
+        }
+
+        List document(names.size());
+        document[0] = start;
+        document[1] = end;
+        size_t field = 2;
+
+        if(code_points) {
+            // Spans are in order, so a single pass over the text counts the code points before each offset.
+            IntegerVector char_start(n_tokens), char_end(n_tokens);
+            const utf8_text_view &text = text_views[i];
+            const int32_t length = static_cast< int32_t >(text.length);
+            int32_t offset = 0, n_chars = 0;
+
+            for(size_t j = 0; j < n_tokens; ++j) {
+                for(; offset < spans.start[j]; n_chars++) U8_FWD_1(text.data, offset, length);
+                char_start[j] = n_chars + 1;
+
+                for(; offset < spans.end[j]; n_chars++) U8_FWD_1(text.data, offset, length);
+                char_end[j] = n_chars;
+            }
+
+            document[field++] = char_start;
+            document[field++] = char_end;
+        }
+
+        if(types) {
+            IntegerVector type(n_tokens);
+
+            for(size_t j = 0; j < n_tokens; ++j) type[j] = word_token_type_index(spans.rule_status[j]) + 1;
+
+            type.attr("levels") = type_levels;
+            type.attr("class") = "factor";
+            document[field++] = type;
+        }
+
+        document.attr("names") = names;
+        output_list[i] = document;
+    }
+
+    return output_list;
 }
 
 
+inline void check_sparse_matrix_format(const std::string &format) {
+    if(format != "dgCMatrix" and format != "dgRMatrix") Rcpp::stop("Unknown sparse matrix format '" + format + "'");
+}
+
 // [[Rcpp::export]]
-S4 vectorize_impl(SEXP vectorizer_handle, std::vector< std::string > texts, bool parallel = false, bool with_dimnames = true) {
+S4 vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, bool with_dimnames = true, std::string format = "dgCMatrix") {
     if(!vectorizer_handle) Rcpp::stop("Null pointer");
+    check_sparse_matrix_format(format);
 
     XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
 
-    auto docs = vectorizer->vectorize(texts, parallel);
+    auto docs = vectorizer->vectorize(as_text_views(texts), parallel);
 
     List dimnames;
 
@@ -380,18 +941,35 @@ S4 vectorize_impl(SEXP vectorizer_handle, std::vector< std::string > texts, bool
         dimnames = List::create(R_NilValue, R_NilValue);
     }
 
-    return vectorizer->as_dgCMatrix(docs, dimnames);
+    return vectorizer->as_sparse_matrix(docs, vectorizer->vocabulary.size(), dimnames, format, parallel);
 }
 
+// Moves the sentence vectors of each document to its rows of a single matrix.
+struct SentenceRowsWorker : public RcppParallel::Worker {
+    std::vector< txtlib::SentenceVectors > &docs;
+    const std::vector< size_t > &offsets;
+    std::vector< txtlib::UAX29Vectorizer::document_vector_t > &rows;
+
+    SentenceRowsWorker(std::vector< txtlib::SentenceVectors > &docs, const std::vector< size_t > &offsets,
+                       std::vector< txtlib::UAX29Vectorizer::document_vector_t > &rows) :
+        docs(docs), offsets(offsets), rows(rows) {};
+
+    void operator()(size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i) {
+            std::move(docs[i].begin(), docs[i].end(), rows.begin() + offsets[i]);
+            txtlib::SentenceVectors().swap(docs[i]);
+        }
+    }
+};
+
 // [[Rcpp::export]]
-List sentence_vectorize_impl(SEXP vectorizer_handle, std::vector<std::string> texts, bool parallel = false, bool with_dimnames = true) {
+List sentence_vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, bool with_dimnames = true, std::string format = "dgCMatrix", bool combined = false) {
     if(!vectorizer_handle) Rcpp::stop("Null pointer");
+    check_sparse_matrix_format(format);
 
     XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
 
-    List output_list(texts.size());
-
-    auto docs = vectorizer->vectorize_sentences(texts, parallel);
+    auto docs = vectorizer->vectorize_sentences(as_text_views(texts), parallel);
 
     List dimnames;
 
@@ -401,11 +979,85 @@ List sentence_vectorize_impl(SEXP vectorizer_handle, std::vector<std::string> te
         dimnames = List::create(R_NilValue, R_NilValue);
     }
 
+    if(combined) {
+        // A single sentences x vocabulary matrix: document i's sentences are rows sentence_offsets[i] + 1 to
+        // sentence_offsets[i + 1], and doc_id holds the document of each row.
+        std::vector< size_t > offsets(docs.size() + 1, 0);
+        for(size_t i = 0; i < docs.size(); ++i) offsets[i + 1] = offsets[i] + docs[i].size();
+
+        if(offsets.back() > static_cast< size_t >(std::numeric_limits< int >::max())) Rcpp::stop("Too many sentences for a sparse matrix");
+
+        std::vector< txtlib::UAX29Vectorizer::document_vector_t > rows(offsets.back());
+        SentenceRowsWorker worker(docs, offsets, rows);
+
+        if(parallel) {
+            RcppParallel::parallelFor(0, docs.size(), worker, 1000);
+        } else {
+            worker(0, docs.size());
+        }
+
+        IntegerVector doc_id(rows.size()), sentence_offsets(offsets.size());
+
+        for(size_t i = 0; i < docs.size(); ++i) {
+            std::fill(doc_id.begin() + offsets[i], doc_id.begin() + offsets[i + 1], static_cast< int >(i + 1));
+        }
+        std::copy(offsets.begin(), offsets.end(), sentence_offsets.begin());
+
+        return List::create(
+            Named("matrix") = vectorizer->as_sparse_matrix(rows, vectorizer->vocabulary.size(), dimnames, format, parallel),
+            Named("doc_id") = doc_id,
+            Named("sentence_offsets") = sentence_offsets
+        );
+    }
+
+    List output_list(texts.size());
+
     for(size_t i = 0; i < docs.size(); ++i) {
-        output_list[i] = vectorizer->as_dgCMatrix(docs[i], dimnames);
+        output_list[i] = vectorizer->as_sparse_matrix(docs[i], vectorizer->vocabulary.size(), dimnames, format);
     }
 
     return output_list;
 }
 
+// [[Rcpp::export]]
+S4 hash_vectorize_impl(SEXP vectorizer_handle, StringVector texts, bool parallel = false, std::string format = "dgCMatrix") {
+    if(!vectorizer_handle) Rcpp::stop("Null pointer");
+    check_sparse_matrix_format(format);
+
+    XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
+
+    if(vectorizer->feature_hasher.n_features == 0) Rcpp::stop("n_features should be > 0");
+
+    auto docs = vectorizer->hash_vectorize(as_text_views(texts), parallel);
+
+    return vectorizer->as_sparse_matrix(docs, vectorizer->feature_hasher.n_features, List::create(R_NilValue, R_NilValue), format, parallel);
+}
+
+inline StringVector as_utf8_character_vector(const std::vector< std::string > &strings) {
+    StringVector out(strings.size());
+    for(size_t i = 0; i < strings.size(); ++i) out[i] = Rf_mkCharLenCE(strings[i].data(), strings[i].size(), CE_UTF8);
+
+    return out;
+}
+
+// [[Rcpp::export]]
+StringVector fit_vocabulary_impl(SEXP vectorizer_handle, StringVector texts, double min_df, double max_df, size_t max_features = 0, bool parallel = false) {
+    if(!vectorizer_handle) Rcpp::stop("Null pointer");
+
+    XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
+
+    return as_utf8_character_vector(vectorizer->fit_vocabulary(as_text_views(texts), parallel, min_df, max_df, max_features));
+}
+
+// [[Rcpp::export]]
+S4 fit_transform_impl(SEXP vectorizer_handle, StringVector texts, double min_df, double max_df, size_t max_features = 0, bool parallel = false, std::string format = "dgCMatrix") {
+    if(!vectorizer_handle) Rcpp::stop("Null pointer");
+    check_sparse_matrix_format(format);
 
+    XPtr< txtlib::UAX29Vectorizer > vectorizer(vectorizer_handle);
+
+    std::vector< std::string > vocabulary;
+    auto docs = vectorizer->fit_transform(as_text_views(texts), parallel, min_df, max_df, max_features, vocabulary);
+
+    return vectorizer->as_sparse_matrix(docs, vocabulary.size(), List::create(R_NilValue, as_utf8_character_vector(vocabulary)), format, parallel);
+}
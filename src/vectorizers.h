@@ -7,25 +7,35 @@
 
 #include <RcppArmadillo.h>
 #include <RcppParallel.h>
+#include <memory>
 #include <string>
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <type_traits>
+#include <cstdlib>
 
 #include "utf8.h"
 #include "mutable_string_view.h"
 #include "stemming.h"
 #include "parsers.h"
+#include "term_dictionary.h"
+#include "murmur3.h"
 
 
 // [[Rcpp::plugins(cpp11)]]
 // [[Rcpp::depends(RcppParallel)]]
 
+#if RCPP_PARALLEL_USE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
 #include <sparsepp/spp.h>
 
 namespace txtlib {
 
-    typedef spp::sparse_hash_map< size_t, std::wstring > aliases_map_t;
-    typedef spp::sparse_hash_map< size_t, size_t > vocabulary_map_t;
+    typedef TermDictionary< std::wstring > aliases_map_t;
+    typedef TermDictionary< size_t > vocabulary_map_t;
 
     inline aliases_map_t as_alias_map(const Rcpp::StringVector &named_list) {
         aliases_map_t out;
@@ -40,67 +50,364 @@ namespace txtlib {
 
             std::wstring replacement_string = utf8_to_ws(named_list[i]);
 
-            out[term_view.hash()] = replacement_string;
+            out.insert(term_view, replacement_string);
         }
 
         return out;
     }
 
     inline void do_replacement(mutable_wstring_view &term, const aliases_map_t &replacement_map) {
-        aliases_map_t::iterator element = replacement_map.find(term.hash());
+        const std::wstring *replacement = replacement_map.find(term);
 
-        if(element != replacement_map.end()) {
-            mutable_wstring_view term_view(&element->second[0], element->second.length());
+        if(replacement != nullptr) {
+            mutable_wstring_view term_view(const_cast< wchar_t* >(replacement->data()), replacement->length());
             term = term_view;
         }
     }
 
+    // Tokens of a document, encoded as UTF-8 back to back in a single buffer so emitting a token doesn't allocate.
+    class TokenizedDocument {
+    public:
+        std::string buffer;
+        std::vector< size_t > offsets;  // Token i spans buffer[offsets[i], offsets[i + 1]).
+
+        TokenizedDocument() : offsets(1, 0UL) {};
+
+        size_t size() const { return this->offsets.size() - 1; }
+        bool empty() const { return this->size() == 0; }
+
+        const char* token_data(size_t i) const { return this->buffer.data() + this->offsets[i]; }
+        size_t token_size(size_t i) const { return this->offsets[i + 1] - this->offsets[i]; }
+        std::string at(size_t i) const { return std::string(this->token_data(i), this->token_size(i)); }
+
+        // Appends characters to the token being written. end_token() closes it.
+        void append(const mutable_wstring_view &chars) { append_utf8(this->buffer, chars.begin(), chars.end()); }
+        void append(char c) { this->buffer.push_back(c); }
+        void end_token() { this->offsets.push_back(this->buffer.size()); }
+
+        void push_back(const mutable_wstring_view &token) {
+            this->append(token);
+            this->end_token();
+        }
+    };
+
+    inline Rcpp::StringVector as_character_vector(const TokenizedDocument &document) {
+        Rcpp::StringVector out(document.size());
+
+        for(size_t i = 0; i < document.size(); ++i)
+            out[i] = Rf_mkCharLenCE(document.token_data(i), document.token_size(i), CE_UTF8);
+
+        return out;
+    }
+
+    // Where a document's tokens are in its UTF-8 text, as byte offsets, with the word rule status of each token.
+    class TokenSpans {
+    public:
+        std::vector< int32_t > start;  // First byte of each token.
+        std::vector< int32_t > end;    // One past the last byte of each token.
+        std::vector< int32_t > rule_status;
+
+        size_t size() const { return this->start.size(); }
+
+        // Span of the token being processed, only kept if the token is emitted.
+        void set_candidate(const IToken< mutable_wstring_view > &token) {
+            this->candidate_start = static_cast< int32_t >(token.start_position);
+            this->candidate_end = static_cast< int32_t >(token.end_position);
+            this->candidate_status = token.rule_status;
+        }
+
+        void push_candidate() {
+            this->start.push_back(this->candidate_start);
+            this->end.push_back(this->candidate_end);
+            this->rule_status.push_back(this->candidate_status);
+        }
+
+    private:
+        int32_t candidate_start = 0;
+        int32_t candidate_end = 0;
+        int32_t candidate_status = 0;
+    };
+
+    // Maps terms to a fixed number of columns with the MurmurHash3 (x86, 32 bits) of their UTF-8 bytes, as tokenize()
+    // outputs them, like scikit-learn's HashingVectorizer: the column is the hash's absolute value modulo n_features
+    // and, with alternate_sign, terms with a negative hash count -1 so that collisions tend to cancel out.
+    struct FeatureHasher {
+        size_t n_features = 0;
+        uint32_t seed = 0;
+        bool alternate_sign = false;
+
+        FeatureHasher() {};
+        FeatureHasher(size_t n_features, uint32_t seed, bool alternate_sign) :
+            n_features(n_features), seed(seed), alternate_sign(alternate_sign) {};
+
+        template < class features_t >
+        void put(const std::string &term, features_t &features) const {
+            const int32_t term_hash = static_cast< int32_t >(MurmurHash3_x86_32(term.data(), term.size(), this->seed));
+            const size_t column = static_cast< size_t >(std::llabs(static_cast< long long >(term_hash))) % this->n_features;
+
+            features[column] += (this->alternate_sign and term_hash < 0) ? -1.0 : 1.0;
+        }
+    };
+
+    // Hashed term counts of a document, by column.
+    class HashedDocument {
+    public:
+        typedef spp::sparse_hash_map< size_t, double > features_t;
+
+        features_t features;
+        std::string term;  // UTF-8 bytes of the term being hashed.
+
+        size_t size() const { return this->features.size(); }
+        features_t::const_iterator begin() const { return this->features.begin(); }
+        features_t::const_iterator end() const { return this->features.end(); }
+    };
+
+    // Counts of a document's vocabulary terms, by term index, reused by all the documents a thread vectorizes: a count
+    // per vocabulary term and the list of the terms counted, so emitting and resetting the counts only visits those.
+    class TermCounter {
+    public:
+        typedef std::vector< std::pair< uint32_t, uint32_t > > counts_t;  // (term index, count), sorted by term.
+
+        TermCounter(size_t n_terms) : counts(n_terms, 0) {};
+
+        void add(size_t term) {
+            if(this->counts[term]++ == 0) this->touched.push_back(static_cast< uint32_t >(term));
+        }
+
+        // Moves the counts since the last flush to out and resets them.
+        void flush(counts_t &out) {
+            std::sort(this->touched.begin(), this->touched.end());
+
+            out.reserve(out.size() + this->touched.size());
+            for(uint32_t term : this->touched) {
+                out.push_back(std::make_pair(term, this->counts[term]));
+                this->counts[term] = 0;
+            }
+
+            this->touched.clear();
+        }
+
+    private:
+        std::vector< uint32_t > counts;
+        std::vector< uint32_t > touched;
+    };
+
+    // Vocabulary term counts of a document (or sentence), as (term index, count) pairs sorted by term. Terms are
+    // counted by the counter of the thread parsing the document until finish() moves their counts here.
+    class DocumentVector {
+    public:
+        typedef TermCounter::counts_t counts_t;
+
+        TermCounter *counter = nullptr;
+        counts_t counts;
+
+        DocumentVector() {};
+        DocumentVector(TermCounter *counter) : counter(counter) {};
+
+        void add(size_t term) { this->counter->add(term); }
+        void finish() { this->counter->flush(this->counts); this->counter = nullptr; }
+
+        size_t size() const { return this->counts.size(); }
+        bool empty() const { return this->counts.empty(); }
+        counts_t::const_iterator begin() const { return this->counts.begin(); }
+        counts_t::const_iterator end() const { return this->counts.end(); }
+    };
+
+    // Vectors of a document's sentences, all counted by the same counter.
+    class SentenceVectors : public std::vector< DocumentVector > {
+    public:
+        TermCounter *counter = nullptr;
+    };
+
+    // Term and document frequencies of the terms of a set of documents, for fitting a vocabulary. Documents are counted
+    // one after the other: new_document() starts counting the terms of the next one.
+    class TermFrequencies {
+    public:
+        struct Counts {
+            size_t term_frequency = 0;
+            size_t document_frequency = 0;
+            size_t last_document = static_cast< size_t >(-1);  // Last document the term was counted in.
+        };
+
+        TermDictionary< Counts > terms;
+
+        void new_document(size_t document) { this->document = document; }
+
+        // Terms with a token containing '_' aren't counted: a vocabulary term with '_' is an n-gram of the tokens
+        // between them, so these terms would never be matched.
+        static bool is_vocabulary_term(const mutable_wstring_view *tokens, size_t n_tokens) {
+            for(size_t i = 0; i < n_tokens; ++i)
+                if(std::wmemchr(tokens[i].data(), L'_', tokens[i].size()) != nullptr) return false;
+
+            return true;
+        }
+
+        // Counts a term in the current document and returns its id.
+        size_t add(const mutable_wstring_view *tokens, size_t n_tokens, size_t term_hash) {
+            const size_t id = this->terms.find_or_insert(tokens, n_tokens, term_hash);
+            Counts &counts = this->terms.value(id);
+
+            counts.term_frequency++;
+            if(counts.last_document != this->document) {
+                counts.document_frequency++;
+                counts.last_document = this->document;
+            }
+
+            return id;
+        }
+
+        // Adds the frequencies counted over other documents. Returns the id each of the other's terms has in this one.
+        std::vector< size_t > merge(const TermFrequencies &other) {
+            return this->terms.merge(other.terms, [](Counts &counts, const Counts &other_counts) {
+                counts.term_frequency += other_counts.term_frequency;
+                counts.document_frequency += other_counts.document_frequency;
+            });
+        }
+
+        // Ids of the terms appearing in at least min_df and at most max_df documents, keeping the max_features most
+        // frequent ones (all of them if 0), sorted by term. The terms are returned in the same order, as UTF-8.
+        std::vector< size_t > select(double min_df, double max_df, size_t max_features, std::vector< std::string > &selected_terms) const;
+
+    private:
+        size_t document = 0;
+    };
+
+    // Term counts of a document by provisional term id: the term's id in the frequencies counted by the thread that
+    // parsed the document, until fit_transform settles the vocabulary.
+    class ProvisionalDocument {
+    public:
+        typedef spp::sparse_hash_map< size_t, size_t > counts_t;
+
+        TermFrequencies *frequencies = nullptr;
+        counts_t counts;
+    };
+
+    // Provisional documents, with the frequencies their term ids refer to.
+    struct ProvisionalVectors {
+        std::vector< ProvisionalDocument > documents;
+        std::vector< std::unique_ptr< TermFrequencies > > frequencies;
+    };
+
+    // Word token types, from the ICU word rule status of a token.
+    enum WordTokenType {
+        WORD_NONE = 1UL,
+        WORD_NUMBER = 2UL,
+        WORD_LETTER = 4UL,
+        WORD_KANA = 8UL,
+        WORD_IDEO = 16UL
+    };
+
+    const static std::map< std::string, uint64_t > WordTokenTypeValues = {
+        {"none", WORD_NONE},
+        {"number", WORD_NUMBER},
+        {"letter", WORD_LETTER},
+        {"kana", WORD_KANA},
+        {"ideo", WORD_IDEO}
+    };
+
+    // ICU's rule status ranges are [0, 100) for none, [100, 200) for numbers and so on up to ideographs.
+    inline int word_token_type_index(int32_t rule_status) {
+        return std::min(std::max(rule_status, 0) / 100, 4);
+    }
+
+    inline uint64_t word_token_type(int32_t rule_status) {
+        return 1UL << word_token_type_index(rule_status);
+    }
+
+    // Whether a return document type is split into sentences. Only those need the parser's sentence iterator.
+    template < class return_document_t > struct has_sentences : std::false_type {};
+    template < class sentence_t > struct has_sentences< std::vector< sentence_t > > : std::true_type {};
+    template <> struct has_sentences< SentenceVectors > : std::true_type {};
+
+    // Whether a return document type only counts vocabulary terms, so n-grams that can't be in the vocabulary can be
+    // skipped.
+    template < class return_document_t > struct counts_vocabulary_terms : std::false_type {};
+    template <> struct counts_vocabulary_terms< DocumentVector > : std::true_type {};
+    template <> struct counts_vocabulary_terms< SentenceVectors > : std::true_type {};
+
+    // Whether a return document type holds n-grams. Token spans don't.
+    template < class return_document_t > struct has_ngrams : std::true_type {};
+    template <> struct has_ngrams< TokenSpans > : std::false_type {};
+
     // Ngrams generators forward declaration.
     class NGramView;
     template < class document_vector_t > class NGramsGenerator;
     template < class document_vector_t > class BigramsGenerator;
     template < class document_vector_t > class NoOpNGramsGenerator;
 
+    // Stages of the per-token pipeline parse_text is compiled for, so stages that are off compile away. ngrams is 1
+    // (no n-grams), 2 (bigrams) or 0 (any other size).
+    template < bool lowercase_, bool stemming_, bool aliases_, unsigned int ngrams_ >
+    struct TokenPipeline {
+        static const bool lowercase = lowercase_;
+        static const bool stemming = stemming_;
+        static const bool aliases = aliases_;
+        static const unsigned int ngrams = ngrams_;
+    };
+
+    template < class document_vector_t, unsigned int ngrams > struct ngrams_generator_type { typedef NGramsGenerator< document_vector_t > type; };
+    template < class document_vector_t > struct ngrams_generator_type< document_vector_t, 1 > { typedef NoOpNGramsGenerator< document_vector_t > type; };
+    template < class document_vector_t > struct ngrams_generator_type< document_vector_t, 2 > { typedef BigramsGenerator< document_vector_t > type; };
+
     class UAX29Vectorizer {
 
     public:
-        typedef std::vector< std::string > document_t;
-        typedef spp::sparse_hash_map< size_t, size_t > document_vector_t;
+        typedef TokenizedDocument document_t;
+        typedef DocumentVector document_vector_t;
 
         UAX29Vectorizer(std::vector< std::string > vocabulary,
                         unsigned int ngrams_size,
                         unsigned int min_term_length,
                         uint64_t word_token_mask,
                         uint64_t non_word_token_mask,
+                        uint64_t word_token_type_mask,
                         std::string casing_transformation,
                         aliases_map_t case_sensitive_aliases,
                         aliases_map_t case_insensitive_aliases,
                         std::string stem_language,
-                        std::string locale);
+                        std::string locale,
+                        FeatureHasher feature_hasher = FeatureHasher());
 
         ~UAX29Vectorizer();
 
         // Public properties.
         std::vector< std::string > vocabulary;
         vocabulary_map_t vocabulary_map;
+        PerfectHashSet ngram_prefixes;  // Hashes of the vocabulary n-grams' prefixes, from their first token to all of them.
         // User-configurable properties.
         unsigned int ngrams_size = 1;
         unsigned int min_term_length = 1;
         uint64_t word_token_mask = 2147483647ULL;
         uint64_t non_word_token_mask = 0ULL;
+        uint64_t word_token_type_mask = 0ULL;  // When set, tokens are selected by rule status instead of categories.
         std::string stem_language;
         std::string locale;
         aliases_map_t case_sensitive_aliases;
         aliases_map_t case_insensitive_aliases;
+        FeatureHasher feature_hasher;
 
         // Public methods.
-        std::vector< document_t > tokenize(const std::vector< std::string > &documents, bool parallel);
+        std::vector< document_t > tokenize(const texts_t &documents, bool parallel);
 
-        std::vector< std::vector < document_t > > tokenize_sentences(const std::vector< std::string > &documents, bool parallel);
+        std::vector< std::vector < document_t > > tokenize_sentences(const texts_t &documents, bool parallel);
 
-        std::vector< document_vector_t > vectorize(const std::vector< std::string > &documents, bool parallel);
+        std::vector< document_vector_t > vectorize(const texts_t &documents, bool parallel);
 
-        std::vector< std::vector < document_vector_t > > vectorize_sentences(const std::vector< std::string > &documents, bool parallel);
+        std::vector< SentenceVectors > vectorize_sentences(const texts_t &documents, bool parallel);
+
+        std::vector< TokenSpans > tokenize_spans(const texts_t &documents, bool parallel);
+
+        std::vector< HashedDocument > hash_vectorize(const texts_t &documents, bool parallel);
+
+        TermFrequencies count_terms(const texts_t &documents, bool parallel);
+
+        // Terms appearing in at least min_df and at most max_df documents, keeping the max_features most frequent ones
+        // (all of them if 0), sorted.
+        std::vector< std::string > fit_vocabulary(const texts_t &documents, bool parallel, double min_df, double max_df, size_t max_features);
+
+        // Fits a vocabulary as fit_vocabulary does and vectorizes the documents with it, parsing them once.
+        std::vector< document_vector_t > fit_transform(const texts_t &documents, bool parallel, double min_df, double max_df, size_t max_features,
+                                                       std::vector< std::string > &fitted_vocabulary);
 
         void put_token(mutable_wstring_view &token, document_vector_t &document_vector);
         void put_token(const NGramView &token, document_vector_t &document_vector);
@@ -113,73 +420,240 @@ namespace txtlib {
         void put_token(const NGramView &token, std::vector< document_t > &document) { this->put_token(token, document.back()); };
 
         // Sentence vectors.
-        void put_token(mutable_wstring_view &token, std::vector< document_vector_t > &document) { this->put_token(token, document.back()); };
-        void put_token(const NGramView &token, std::vector< document_vector_t > &document) { this->put_token(token, document.back()); };
+        void put_token(mutable_wstring_view &token, SentenceVectors &document) { this->put_token(token, document.back()); };
+        void put_token(const NGramView &token, SentenceVectors &document) { this->put_token(token, document.back()); };
+
+        // Token spans. Only single tokens have a span.
+        void put_token(mutable_wstring_view &token, TokenSpans &document) { document.push_candidate(); };
+        void put_token(const NGramView &token, TokenSpans &document) {};
+
+        // Hashed vectors.
+        void put_token(mutable_wstring_view &token, HashedDocument &document);
+        void put_token(const NGramView &token, HashedDocument &document);
+
+        // Term frequencies.
+        void put_token(mutable_wstring_view &token, TermFrequencies &document) {
+            if(TermFrequencies::is_vocabulary_term(&token, 1)) document.add(&token, 1, token.hash());
+        };
+        void put_token(const NGramView &token, TermFrequencies &document);
+
+        // Provisional vectors.
+        void put_token(mutable_wstring_view &token, ProvisionalDocument &document) {
+            if(TermFrequencies::is_vocabulary_term(&token, 1)) document.counts[document.frequencies->add(&token, 1, token.hash())]++;
+        };
+        void put_token(const NGramView &token, ProvisionalDocument &document);
+
+        template < class return_document_t >
+        void set_candidate(const IToken< mutable_wstring_view > &token, return_document_t &document) {};
+        void set_candidate(const IToken< mutable_wstring_view > &token, TokenSpans &document) { document.set_candidate(token); };
 
         void new_sentence(document_t &document) {};  // Nothing to do here, as these return types don't include sentences.
         void new_sentence(document_vector_t &document) {};
+        void new_sentence(TokenSpans &document) {};
+        void new_sentence(HashedDocument &document) {};
+        void new_sentence(TermFrequencies &document) {};
+        void new_sentence(ProvisionalDocument &document) {};
         void new_sentence(std::vector< document_t > &document);  // Token sentences.
-        void new_sentence(std::vector< document_vector_t > &document);  // Sentence vectors.
+        void new_sentence(SentenceVectors &document);  // Sentence vectors.
 
         void trim_document(document_t &document) {};
         void trim_document(document_vector_t &document) {};
         void trim_document(std::vector< document_t > &document);
-        void trim_document(std::vector< document_vector_t > &document);
+        void trim_document(SentenceVectors &document);
+
+        // Vectors count their terms with the counter of the thread parsing them, and get the counts once parsed.
+        template < class return_document_t >
+        void bind_counter(return_document_t &document, TermCounter &counter) {};
+        void bind_counter(document_vector_t &document, TermCounter &counter) { document.counter = &counter; };
+        void bind_counter(SentenceVectors &document, TermCounter &counter) { document.counter = &counter; };
+
+        template < class return_document_t >
+        void finish_document(return_document_t &document) {};
+        void finish_document(document_vector_t &document) { document.finish(); };
+        void finish_document(SentenceVectors &document) {
+            if(!document.empty()) document.back().finish();
+            document.counter = nullptr;
+        };
+
 
+        // Rows are documents iterating over (column, value) pairs, like document_vector_t and HashedDocument.
+        template < class row_t >
+        Rcpp::S4 as_dgCMatrix(const std::vector< row_t > &rows, size_t n_columns, const Rcpp::List &dimnames, bool parallel = false);
 
-        Rcpp::S4 as_dgCMatrix(const std::vector< document_vector_t > &doc, const Rcpp::List &dimnames);
+        template < class row_t >
+        Rcpp::S4 as_dgRMatrix(const std::vector< row_t > &rows, size_t n_columns, const Rcpp::List &dimnames, bool parallel = false);
+
+        // Builds a dgCMatrix or a dgRMatrix, as format says.
+        template < class row_t >
+        Rcpp::S4 as_sparse_matrix(const std::vector< row_t > &rows, size_t n_columns, const Rcpp::List &dimnames, const std::string &format, bool parallel = false) {
+            if(format == "dgRMatrix") return this->as_dgRMatrix(rows, n_columns, dimnames, parallel);
+            return this->as_dgCMatrix(rows, n_columns, dimnames, parallel);
+        }
 
     protected:
         // Internal attributes.
         UAX29Parser< mutable_wstring_view > *parser;
         txtlib::Stemmer* stemmer;
-        std::function< void(wchar_t &code) > casing_transform_function = txtlib::preserve_case;
+        bool lowercase = false;
 
         // Internal methods.
-        template < class return_document_t >
-        std::vector< return_document_t > process_texts(const std::vector< std::string > &documents, bool parallel = false);
+        bool is_word_token(const IToken< mutable_wstring_view > &token) const {
+            if(token.end_position == token.start_position) return false;
+            if(this->word_token_type_mask != 0) return word_token_type(token.rule_status) & this->word_token_type_mask;
+
+            return (token.token_mask & this->word_token_mask) and !(token.token_mask & this->non_word_token_mask);
+        }
 
         template < class return_document_t >
-        return_document_t parse_text(const std::string &text,
-                                     txtlib::UAX29Parser< mutable_wstring_view > &parser,
-                                     txtlib::Stemmer &stemmer,
-                                     NGramsGenerator< return_document_t > *ngrams_generator);
-
-        template < class document_vector_t >
-        NGramsGenerator< document_vector_t >* create_ngrams_generator_pointer() {
-            switch(this->ngrams_size) {
-                case 1: return new NoOpNGramsGenerator< document_vector_t >(this);
-                case 2: return new BigramsGenerator< document_vector_t >(this);
-                default: return new NGramsGenerator< document_vector_t >(this);
-            }
+        std::vector< return_document_t > process_texts(const texts_t &documents, bool parallel = false) {
+            std::vector< return_document_t > vectors(documents.size());
+            this->process_texts< return_document_t >(documents, parallel, vectors);
+            return vectors;
         }
 
-        template <class return_document_t>
+        // Picks the token pipeline for this vectorizer's configuration, one stage at a time, and runs it. The output is
+        // either a vector with a return document per text or a TermFrequencies of all texts.
+        template < class return_document_t, class output_t >
+        void process_texts(const texts_t &documents, bool parallel, output_t &output);
+
+        template < class return_document_t, bool lowercase, class output_t >
+        void process_texts_stemming(const texts_t &documents, bool parallel, output_t &output);
+
+        template < class return_document_t, bool lowercase, bool stemming, class output_t >
+        void process_texts_aliases(const texts_t &documents, bool parallel, output_t &output);
+
+        template < class return_document_t, bool lowercase, bool stemming, bool aliases, class output_t >
+        void process_texts_ngrams(const texts_t &documents, bool parallel, output_t &output);
+
+        template < class return_document_t, class pipeline_t >
+        void run_pipeline(const texts_t &documents, bool parallel, std::vector< return_document_t > &vectors);
+
+        template < class return_document_t, class pipeline_t >
+        void run_pipeline(const texts_t &documents, bool parallel, TermFrequencies &frequencies);
+
+        template < class return_document_t, class pipeline_t >
+        void run_pipeline(const texts_t &documents, bool parallel, ProvisionalVectors &vectors);
+
+        // Adds the tokens of a text to a document.
+        template < class return_document_t, class pipeline_t >
+        void parse_text(const utf8_text_view &text,
+                        return_document_t &doc,
+                        txtlib::UAX29Parser< mutable_wstring_view > &parser,
+                        txtlib::Stemmer &stemmer,
+                        typename ngrams_generator_type< return_document_t, pipeline_t::ngrams >::type &ngrams_generator);
+
+        // Parser, stemmer, n-grams generator and term counter of a worker thread, reused by all the chunks the thread
+        // runs. The counter only has room for the vocabulary when the thread counts vocabulary terms.
+        template < class return_document_t, class pipeline_t >
+        struct UAX29WorkerState {
+            UAX29Parser< mutable_wstring_view > parser;
+            std::unique_ptr< Stemmer > stemmer;
+            typename ngrams_generator_type< return_document_t, pipeline_t::ngrams >::type ngrams_generator;
+            TermCounter counter;
+
+            UAX29WorkerState(UAX29Vectorizer &vectorizer) :
+                parser(vectorizer.locale),
+                stemmer(create_stemmer_pointer(vectorizer.stem_language)),
+                ngrams_generator(&vectorizer),
+                counter(counts_vocabulary_terms< return_document_t >::value ? vectorizer.vocabulary.size() : 0) {
+                parser.classify_by_rule_status(vectorizer.word_token_type_mask != 0);
+            }
+        };
+
+#if RCPP_PARALLEL_USE_TBB
+        template < class return_document_t, class pipeline_t >
+        using worker_states_t = tbb::enumerable_thread_specific< std::unique_ptr< UAX29WorkerState< return_document_t, pipeline_t > > >;
+
+        template < class return_document_t, class pipeline_t >
         class UAX29VectorizerWorker : public RcppParallel::Worker {
         private:
-            const std::vector< std::string > &texts;
+            const texts_t &texts;
             std::vector< return_document_t > &documents;
             UAX29Vectorizer &vectorizer;
+            worker_states_t< return_document_t, pipeline_t > &states;
 
         public:
-            UAX29VectorizerWorker(const std::vector< std::string > &texts,
+            UAX29VectorizerWorker(const texts_t &texts,
                                   std::vector< return_document_t > &documents,
-                                  UAX29Vectorizer &vectorizer) : texts(texts), documents(documents), vectorizer(vectorizer) {}
+                                  UAX29Vectorizer &vectorizer,
+                                  worker_states_t< return_document_t, pipeline_t > &states) : texts(texts), documents(documents), vectorizer(vectorizer), states(states) {}
+
+
+            void operator()(size_t begin, size_t end) {
+                std::unique_ptr< UAX29WorkerState< return_document_t, pipeline_t > > &state = states.local();
+                if(!state) state.reset(new UAX29WorkerState< return_document_t, pipeline_t >(vectorizer));
+
+                for (size_t i = begin; i < end; ++i) {
+                    vectorizer.bind_counter(documents[i], state->counter);
+                    vectorizer.parse_text< return_document_t, pipeline_t >(texts[i], documents[i], state->parser, *state->stemmer, state->ngrams_generator);
+                }
+            };
+        };
+
+        // Counts the terms of its ranges of texts into its own frequencies, which are merged when workers are joined.
+        template < class pipeline_t >
+        class TermFrequenciesWorker : public RcppParallel::Worker {
+        private:
+            const texts_t &texts;
+            UAX29Vectorizer &vectorizer;
+            worker_states_t< TermFrequencies, pipeline_t > &states;
+
+        public:
+            TermFrequencies frequencies;
+
+            TermFrequenciesWorker(const texts_t &texts,
+                                  UAX29Vectorizer &vectorizer,
+                                  worker_states_t< TermFrequencies, pipeline_t > &states) : texts(texts), vectorizer(vectorizer), states(states) {}
 
+            TermFrequenciesWorker(const TermFrequenciesWorker &worker, RcppParallel::Split) :
+                texts(worker.texts), vectorizer(worker.vectorizer), states(worker.states) {}
 
             void operator()(size_t begin, size_t end) {
-                NGramsGenerator< return_document_t > *ngrams_generator = vectorizer.create_ngrams_generator_pointer< return_document_t >();
-                Stemmer* stemmer = create_stemmer_pointer(vectorizer.stem_language);
-                UAX29Parser< mutable_wstring_view > parser(vectorizer.locale);
+                std::unique_ptr< UAX29WorkerState< TermFrequencies, pipeline_t > > &state = states.local();
+                if(!state) state.reset(new UAX29WorkerState< TermFrequencies, pipeline_t >(vectorizer));
 
                 for (size_t i = begin; i < end; ++i) {
-                    documents[i] = vectorizer.parse_text< return_document_t >(texts[i], parser, *stemmer, ngrams_generator);
+                    frequencies.new_document(i);
+                    vectorizer.parse_text< TermFrequencies, pipeline_t >(texts[i], frequencies, state->parser, *state->stemmer, state->ngrams_generator);
                 }
+            };
+
+            void join(const TermFrequenciesWorker &worker) { frequencies.merge(worker.frequencies); }
+        };
 
-                delete stemmer;
-                delete ngrams_generator;
+        // Parses documents into provisional vectors, with the terms' ids in the frequencies of the worker's thread.
+        template < class pipeline_t >
+        class ProvisionalVectorsWorker : public RcppParallel::Worker {
+        private:
+            const texts_t &texts;
+            std::vector< ProvisionalDocument > &documents;
+            UAX29Vectorizer &vectorizer;
+            worker_states_t< ProvisionalDocument, pipeline_t > &states;
+            tbb::enumerable_thread_specific< std::unique_ptr< TermFrequencies > > &frequencies;
+
+        public:
+            ProvisionalVectorsWorker(const texts_t &texts,
+                                     std::vector< ProvisionalDocument > &documents,
+                                     UAX29Vectorizer &vectorizer,
+                                     worker_states_t< ProvisionalDocument, pipeline_t > &states,
+                                     tbb::enumerable_thread_specific< std::unique_ptr< TermFrequencies > > &frequencies) :
+                texts(texts), documents(documents), vectorizer(vectorizer), states(states), frequencies(frequencies) {}
+
+            void operator()(size_t begin, size_t end) {
+                std::unique_ptr< UAX29WorkerState< ProvisionalDocument, pipeline_t > > &state = states.local();
+                if(!state) state.reset(new UAX29WorkerState< ProvisionalDocument, pipeline_t >(vectorizer));
+
+                std::unique_ptr< TermFrequencies > &thread_frequencies = frequencies.local();
+                if(!thread_frequencies) thread_frequencies.reset(new TermFrequencies());
+
+                for (size_t i = begin; i < end; ++i) {
+                    thread_frequencies->new_document(i);
+                    documents[i].frequencies = thread_frequencies.get();
+                    vectorizer.parse_text< ProvisionalDocument, pipeline_t >(texts[i], documents[i], state->parser, *state->stemmer, state->ngrams_generator);
+                }
             };
         };
+#endif
 
     };
 
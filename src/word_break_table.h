@@ -0,0 +1,54 @@
+// Generated by tools/generate_word_break_table.py from Unicode 15.0.0 data. Do not edit by hand.
+#ifndef _WORD_BREAK_TABLE_
+#define _WORD_BREAK_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {
+    namespace word_break {
+        enum Property : uint8_t {
+            Other = 0,
+            CR = 1,
+            LF = 2,
+            Newline = 3,
+            Extend = 4,
+            ZWJ = 5,
+            Regional_Indicator = 6,
+            Format = 7,
+            Katakana = 8,
+            Hebrew_Letter = 9,
+            ALetter = 10,
+            Single_Quote = 11,
+            Double_Quote = 12,
+            MidNumLet = 13,
+            MidLetter = 14,
+            MidNum = 15,
+            Numeric = 16,
+            ExtendNumLet = 17,
+            WSegSpace = 18
+        };
+
+        // Unicode version of the table and ICU major versions whose root word rules it follows.
+        const int UNICODE_VERSION_MAJOR = 15;
+        const int UNICODE_VERSION_MINOR = 0;
+        const int FIRST_ICU_VERSION = 72;
+        const int LAST_ICU_VERSION = 73;
+
+        const uint8_t PROPERTY_MASK = 0x1F;
+        const uint8_t EXTENDED_PICTOGRAPHIC = 0x20;
+        const uint8_t DICTIONARY = 0x40;
+
+        const int BLOCK_SHIFT = 7;
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const uint8_t stage1[8704];
+        extern const uint8_t stage2[29184];
+
+        // Word_Break property and flags of a code point. Code points must be <= 0x10FFFF.
+        inline uint8_t lookup(uint32_t c) {
+            return stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)];
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef _WORD_SEGMENTER_
+#define _WORD_SEGMENTER_
+
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <unicode/ubrk.h>
+#include <unicode/uchar.h>
+#include <unicode/utf8.h>
+#include <unicode/uvernum.h>
+#include "word_break_table.h"
+
+namespace txtlib {
+
+    // UAX #29 word boundaries over UTF-8 text, driven by the compiled-in Word_Break table and a table of pair rules
+    // instead of ICU's rule engine. Boundaries are byte offsets and match ICU's root word rules. Text that ICU
+    // breaks with dictionaries (CJK and South East Asian scripts) or with rules of its own (Hangul syllables) is not
+    // handled: next() returns DICTIONARY_TEXT when it reaches such a character, or an ideograph, and the caller should
+    // continue with ICU from current().
+    class WordSegmenter {
+        public:
+            static const int32_t DONE = -1;
+            static const int32_t DICTIONARY_TEXT = -2;
+
+            void set_text(const char* text, size_t length) {
+                this->text = text;
+                this->length = static_cast< int32_t >(length);
+                this->boundary = 0;
+            }
+
+            int32_t current() const { return this->boundary; }
+
+            // ICU's rule status (UBRK_WORD_NONE, UBRK_WORD_NUMBER or UBRK_WORD_LETTER) of the segment ending at
+            // current(), as BreakIterator::getRuleStatus() returns it.
+            int32_t rule_status() const { return this->status; }
+
+            // Moves to the next boundary and returns its byte offset.
+            int32_t next() {
+                using namespace word_break;
+
+                if(this->boundary >= this->length) return DONE;
+
+                this->lookahead_dictionary = false;
+                int32_t i = this->boundary;
+                uint8_t c = read(i);
+                if(c & DICTIONARY) return DICTIONARY_TEXT;
+
+                // Last character (raw), last and second to last characters ignoring WB4's Extend/Format/ZWJ, and
+                // the number of consecutive regional indicators.
+                uint8_t raw = c, previous = c & PROPERTY_MASK, before_previous = Other;
+                uint32_t regional_indicators = previous == Regional_Indicator;
+
+                int32_t segment_status = UBRK_WORD_NONE;
+                uint8_t status_property = N_PROPERTIES;
+                update_status(segment_status, status_property, previous);
+
+                while(i < this->length) {
+                    int32_t j = i;
+                    const uint8_t n = read(j);
+                    if(n & DICTIONARY) return DICTIONARY_TEXT;
+
+                    const uint8_t next = n & PROPERTY_MASK;
+                    const uint8_t raw_property = raw & PROPERTY_MASK;
+
+                    if(raw_property == CR && next == LF) {}                                                    // WB3
+                    else if(raw_property == CR || raw_property == LF || raw_property == Newline) break;         // WB3a
+                    else if(next == CR || next == LF || next == Newline) break;                                 // WB3b
+                    else if(raw_property == ZWJ && (n & EXTENDED_PICTOGRAPHIC)) {}                              // WB3c
+                    else if(raw_property == WSegSpace && next == WSegSpace) {}                                  // WB3d
+                    else if(next == Extend || next == Format || next == ZWJ) {                                  // WB4
+                        update_status(segment_status, status_property, next);
+                        raw = n;
+                        i = j;
+                        continue;
+                    }
+                    else if(!joins(previous, before_previous, next, j, regional_indicators)) break;
+
+                    update_status(segment_status, status_property, next);
+                    raw = n;
+                    before_previous = previous;
+                    previous = next;
+                    regional_indicators = next == Regional_Indicator ? regional_indicators + 1 : 0;
+                    i = j;
+                }
+
+                // Boundaries decided by looking at dictionary characters are left to ICU as well.
+                if(this->lookahead_dictionary) return DICTIONARY_TEXT;
+
+                this->boundary = i;
+                this->status = segment_status;
+                return i;
+            }
+
+        private:
+            enum Action : uint8_t {
+                BREAK,
+                JOIN,
+                JOIN_IF_NEXT_AHLETTER,   // WB6
+                JOIN_IF_NEXT_HEBREW,     // WB7b
+                JOIN_IF_NEXT_NUMERIC,    // WB12
+                JOIN_IF_BEFORE_AHLETTER, // WB7
+                JOIN_IF_BEFORE_HEBREW,   // WB7c
+                JOIN_IF_BEFORE_NUMERIC,  // WB11
+                JOIN_IF_ODD_RI           // WB15, WB16
+            };
+
+            static const int N_PROPERTIES = word_break::WSegSpace + 1;
+
+            // Action for every (previous, next) pair of properties after WB4, for rules WB5 to WB16.
+            struct PairTable {
+                uint8_t actions[N_PROPERTIES][N_PROPERTIES];
+
+                PairTable() : actions() {
+                    using namespace word_break;
+                    const uint8_t ahletter[] = {ALetter, Hebrew_Letter};
+                    const uint8_t mid_letter[] = {MidLetter, MidNumLet, Single_Quote};
+                    const uint8_t mid_num[] = {MidNum, MidNumLet, Single_Quote};
+
+                    for(uint8_t a : ahletter) {
+                        for(uint8_t b : ahletter) actions[a][b] = JOIN;                           // WB5
+                        for(uint8_t m : mid_letter) {
+                            actions[a][m] = JOIN_IF_NEXT_AHLETTER;                                // WB6
+                            actions[m][a] = JOIN_IF_BEFORE_AHLETTER;                              // WB7
+                        }
+                        actions[a][Numeric] = JOIN;                                               // WB9
+                        actions[Numeric][a] = JOIN;                                               // WB10
+                        actions[a][ExtendNumLet] = JOIN;                                          // WB13a
+                        actions[ExtendNumLet][a] = JOIN;                                          // WB13b
+                    }
+                    actions[Hebrew_Letter][Single_Quote] = JOIN;                                  // WB7a
+                    actions[Hebrew_Letter][Double_Quote] = JOIN_IF_NEXT_HEBREW;                   // WB7b
+                    actions[Double_Quote][Hebrew_Letter] = JOIN_IF_BEFORE_HEBREW;                 // WB7c
+                    actions[Numeric][Numeric] = JOIN;                                             // WB8
+                    for(uint8_t m : mid_num) {
+                        actions[m][Numeric] = JOIN_IF_BEFORE_NUMERIC;                             // WB11
+                        actions[Numeric][m] = JOIN_IF_NEXT_NUMERIC;                               // WB12
+                    }
+                    actions[Katakana][Katakana] = JOIN;                                           // WB13
+                    for(uint8_t p : {Numeric, Katakana, ExtendNumLet}) {
+                        actions[p][ExtendNumLet] = JOIN;                                          // WB13a
+                        actions[ExtendNumLet][p] = JOIN;                                          // WB13b
+                    }
+                    actions[Regional_Indicator][Regional_Indicator] = JOIN_IF_ODD_RI;             // WB15, WB16
+                }
+            };
+
+            static const PairTable& pair_table() {
+                static const PairTable table;
+                return table;
+            }
+
+            const char* text = nullptr;
+            int32_t length = 0;
+            int32_t boundary = 0;
+            int32_t status = UBRK_WORD_NONE;
+            bool lookahead_dictionary = false;
+
+            // Follows the tags of ICU's word rules: letters tag a segment as a word and digits as a number, while
+            // other characters untag it. The property of the last tagged character is kept in status_property.
+            static void update_status(int32_t &status, uint8_t &status_property, uint8_t property) {
+                using namespace word_break;
+
+                switch(property) {
+                    case Extend:
+                    case Format:
+                    case ZWJ:
+                        // ICU's rules leave these untagged after ExtendNumLet and after a Hebrew letter's quote.
+                        if(status_property == ExtendNumLet || status_property == Single_Quote) status = UBRK_WORD_NONE;
+                        return;
+                    case ALetter:
+                    case Hebrew_Letter:
+                        status = UBRK_WORD_LETTER;
+                        break;
+                    case Numeric:
+                        status = UBRK_WORD_NUMBER;
+                        break;
+                    case ExtendNumLet:
+                        if(status_property == ExtendNumLet) status = UBRK_WORD_LETTER;
+                        break;
+                    case Single_Quote:
+                    case Double_Quote:
+                    case MidNumLet:
+                    case MidLetter:
+                    case MidNum:
+                        break;
+                    default:
+                        status = UBRK_WORD_NONE;
+                }
+
+                status_property = property;
+            }
+
+            // Table entry of the code point at i, advancing i past it. Ill-formed sequences read as U+FFFD, like ICU.
+            uint8_t read(int32_t &i) const {
+                UChar32 c = static_cast< uint8_t >(this->text[i]);
+
+                if(c < 0x80) {
+                    i++;
+                } else {
+                    U8_NEXT(this->text, i, this->length, c);
+                    if(c < 0) c = 0xFFFD;
+                }
+
+                return word_break::lookup(static_cast< uint32_t >(c));
+            }
+
+            // Property of the first character from i that WB4 does not ignore, or Other at the end of the text.
+            uint8_t lookahead(int32_t i) {
+                using namespace word_break;
+
+                while(i < this->length) {
+                    const uint8_t c = read(i);
+                    const uint8_t property = c & PROPERTY_MASK;
+
+                    if(c & DICTIONARY) this->lookahead_dictionary = true;
+                    if(property != Extend && property != Format && property != ZWJ) return property;
+                }
+
+                return Other;
+            }
+
+            bool joins(uint8_t previous, uint8_t before_previous, uint8_t next, int32_t after_next,
+                       uint32_t regional_indicators) {
+                using namespace word_break;
+
+                switch(pair_table().actions[previous][next]) {
+                    case JOIN:
+                        return true;
+                    case JOIN_IF_NEXT_AHLETTER: {
+                        const uint8_t p = lookahead(after_next);
+                        return p == ALetter || p == Hebrew_Letter;
+                    }
+                    case JOIN_IF_NEXT_HEBREW:
+                        return lookahead(after_next) == Hebrew_Letter;
+                    case JOIN_IF_NEXT_NUMERIC:
+                        return lookahead(after_next) == Numeric;
+                    case JOIN_IF_BEFORE_AHLETTER:
+                        return before_previous == ALetter || before_previous == Hebrew_Letter;
+                    case JOIN_IF_BEFORE_HEBREW:
+                        return before_previous == Hebrew_Letter;
+                    case JOIN_IF_BEFORE_NUMERIC:
+                        return before_previous == Numeric;
+                    case JOIN_IF_ODD_RI:
+                        return regional_indicators % 2 == 1;
+                    default:
+                        return false;
+                }
+            }
+    };
+
+    // Whether the ICU in use has the Unicode version and root word rules the Word_Break table was generated from.
+    // On other versions the segmenter could disagree with ICU's own dictionary and sentence segmentation.
+    inline bool word_break_table_matches_icu() {
+        UVersionInfo unicode_version;
+        u_getUnicodeVersion(unicode_version);
+
+        return U_ICU_VERSION_MAJOR_NUM >= word_break::FIRST_ICU_VERSION and U_ICU_VERSION_MAJOR_NUM <= word_break::LAST_ICU_VERSION and
+            unicode_version[0] == word_break::UNICODE_VERSION_MAJOR and unicode_version[1] == word_break::UNICODE_VERSION_MINOR;
+    }
+}
+
+#endif
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Generates src/case_table.h and src/case_table.cpp from the Unicode Character Database.
+
+Usage: python3 tools/generate_case_table.py path/to/UCD
+
+The UCD directory is the extracted UCD.zip of a Unicode release and must contain CaseFolding.txt, from the Unicode
+version of the ICU txtlib is built against.
+
+txtlib's lowercasing is simple case folding (statuses C and S of CaseFolding.txt): one code point to one code point,
+which also folds case variants such as the final sigma or the long s. Every code point gets the index of its folding
+delta (folded code point minus the code point) in a small array of distinct deltas. Indexes are stored in a two-stage
+table of deduplicated blocks.
+"""
+
+import os
+import re
+import sys
+
+from generate_general_category_table import N_CODE_POINTS, build_stages, format_array, read_version
+
+LINE_PATTERN = re.compile(r"^([0-9A-Fa-f]+);\s*([CFST]);\s*([0-9A-Fa-f ]+);")
+
+
+def build_deltas(ucd):
+    folding = {}
+    path = os.path.join(ucd, "CaseFolding.txt")
+
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            match = LINE_PATTERN.match(line)
+            # Full (F) foldings map to several code points and Turkic (T) ones are locale specific.
+            if match and match.group(2) in ("C", "S"):
+                code = int(match.group(1), 16)
+                folding[code] = int(match.group(3), 16) - code
+
+    # Delta 0 (no folding) is index 0.
+    deltas = [0] + sorted(set(folding.values()) - {0})
+    if len(deltas) > 256:
+        sys.exit("Too many distinct case folding deltas for one byte indexes: {}".format(len(deltas)))
+
+    indexes = bytearray(N_CODE_POINTS)
+    for code, delta in folding.items():
+        indexes[code] = deltas.index(delta)
+
+    return indexes, deltas, read_version(path)
+
+
+def main(ucd, output_dir):
+    indexes, deltas, version = build_deltas(ucd)
+
+    # Picks the block size giving the smallest table.
+    best = None
+    for shift in range(4, 11):
+        stage1, stage2 = build_stages(indexes, shift)
+        stage1_type = "uint8_t" if max(stage1) < 256 else "uint16_t"
+        size = len(stage1) * (1 if stage1_type == "uint8_t" else 2) + len(stage2)
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, stage2, stage1_type)
+    size, shift, stage1, stage2, stage1_type = best
+
+    header = "// Generated by tools/generate_case_table.py from Unicode {} data. Do not edit by hand.\n".format(version)
+
+    with open(os.path.join(output_dir, "case_table.h"), "w") as f:
+        f.write(header)
+        f.write("""#ifndef _CASE_TABLE_
+#define _CASE_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {{
+    namespace case_folding {{
+        const int BLOCK_SHIFT = {shift};
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const {stage1_type} stage1[{n_stage1}];
+        extern const uint8_t stage2[{n_stage2}];
+        extern const int32_t deltas[{n_deltas}];
+
+        // Simple case folding of a code point minus the code point. Code points must be <= 0x10FFFF.
+        inline int32_t delta(uint32_t c) {{
+            return deltas[stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)]];
+        }}
+    }}
+}}
+
+#endif
+""".format(shift=shift, stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2), n_deltas=len(deltas)))
+
+    with open(os.path.join(output_dir, "case_table.cpp"), "w") as f:
+        f.write(header)
+        f.write("""#include "case_table.h"
+
+namespace txtlib {{
+    namespace case_folding {{
+        const {stage1_type} stage1[{n_stage1}] = {{
+{stage1}
+        }};
+
+        const uint8_t stage2[{n_stage2}] = {{
+{stage2}
+        }};
+
+        const int32_t deltas[{n_deltas}] = {{
+{deltas}
+        }};
+    }}
+}}
+""".format(stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2), n_deltas=len(deltas),
+           stage1=format_array(stage1), stage2=format_array(list(stage2)), deltas=format_array(deltas, 12)))
+
+    print("Unicode {}: {} deltas, {} blocks of {} code points, {} bytes".format(
+        version, len(deltas), len(stage2) >> shift, 1 << shift, size + 4 * len(deltas)))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: generate_case_table.py path/to/UCD")
+    main(sys.argv[1], os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
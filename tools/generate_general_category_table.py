@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Generates src/general_category_table.h and src/general_category_table.cpp from the Unicode Character Database.
+
+Usage: python3 tools/generate_general_category_table.py path/to/UCD
+
+The UCD directory is the extracted UCD.zip of a Unicode release and must contain UnicodeData.txt and PropList.txt
+(only read for its version header, which UnicodeData.txt lacks). Use the Unicode version of the ICU txtlib is built
+against, like tools/generate_word_break_table.py does.
+
+Every code point gets one byte: the index of its General Category in txtlib::unique_character_groups, with
+unassigned code points mapped to Unknown. Bytes are stored in a two-stage table of deduplicated blocks.
+"""
+
+import os
+import re
+import sys
+
+# Same order as txtlib::unique_character_groups in src/unicode.h.
+CATEGORIES = [
+    "Cc", "Zs", "Po", "Sc", "Ps", "Pe", "Sm", "Pd", "Nd", "Lu", "Sk", "Pc", "Ll", "So", "Lo", "Pi", "Cf", "No", "Pf",
+    "Lt", "Lm", "Mn", "Me", "Mc", "Nl", "Zl", "Zp", "Unknown", "Cs", "Co"
+]
+UNKNOWN = CATEGORIES.index("Unknown")
+
+N_CODE_POINTS = 0x110000
+
+
+def read_version(path):
+    with open(path, encoding="utf-8") as f:
+        match = re.search(r"-(\d+\.\d+\.\d+)\.txt", f.readline())
+        return match.group(1) if match else "unknown"
+
+
+def build_categories(ucd):
+    categories = bytearray([UNKNOWN]) * N_CODE_POINTS
+    range_first = None
+
+    with open(os.path.join(ucd, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = line.split(";")
+            if len(fields) < 3:
+                continue
+            code, name, category = int(fields[0], 16), fields[1], fields[2]
+
+            # Large blocks (CJK ideographs, Hangul syllables, private use...) are listed as a First/Last pair.
+            if name.endswith(", First>"):
+                range_first = code
+                continue
+            first = range_first if name.endswith(", Last>") else code
+            range_first = None
+
+            value = CATEGORIES.index(category) if category in CATEGORIES else UNKNOWN
+            for c in range(first, code + 1):
+                categories[c] = value
+
+    return categories, read_version(os.path.join(ucd, "PropList.txt"))
+
+
+def build_stages(values, shift):
+    block_size = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = bytearray()
+
+    for start in range(0, N_CODE_POINTS, block_size):
+        block = bytes(values[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2 += block
+        stage1.append(blocks[block])
+
+    return stage1, stage2
+
+
+def format_array(values, per_line=24):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("        " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main(ucd, output_dir):
+    categories, version = build_categories(ucd)
+
+    # Picks the block size giving the smallest table.
+    best = None
+    for shift in range(4, 11):
+        stage1, stage2 = build_stages(categories, shift)
+        stage1_type = "uint8_t" if max(stage1) < 256 else "uint16_t"
+        size = len(stage1) * (1 if stage1_type == "uint8_t" else 2) + len(stage2)
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, stage2, stage1_type)
+    size, shift, stage1, stage2, stage1_type = best
+
+    header = "// Generated by tools/generate_general_category_table.py from Unicode {} data. Do not edit by hand.\n".format(version)
+
+    with open(os.path.join(output_dir, "general_category_table.h"), "w") as f:
+        f.write(header)
+        f.write("""#ifndef _GENERAL_CATEGORY_TABLE_
+#define _GENERAL_CATEGORY_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {{
+    namespace general_category {{
+        const int BLOCK_SHIFT = {shift};
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const {stage1_type} stage1[{n_stage1}];
+        extern const uint8_t stage2[{n_stage2}];
+
+        // Index of the General Category of a code point in unique_character_groups. Code points must be <= 0x10FFFF.
+        inline uint8_t lookup(uint32_t c) {{
+            return stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)];
+        }}
+    }}
+}}
+
+#endif
+""".format(shift=shift, stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2)))
+
+    with open(os.path.join(output_dir, "general_category_table.cpp"), "w") as f:
+        f.write(header)
+        f.write("""#include "general_category_table.h"
+
+namespace txtlib {{
+    namespace general_category {{
+        const {stage1_type} stage1[{n_stage1}] = {{
+{stage1}
+        }};
+
+        const uint8_t stage2[{n_stage2}] = {{
+{stage2}
+        }};
+    }}
+}}
+""".format(stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2),
+           stage1=format_array(stage1), stage2=format_array(list(stage2))))
+
+    print("Unicode {}: {} blocks of {} code points, {} bytes".format(version, len(stage2) >> shift, 1 << shift, size))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: generate_general_category_table.py path/to/UCD")
+    main(sys.argv[1], os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""Generates src/word_break_table.h and src/word_break_table.cpp from the Unicode Character Database.
+
+Usage: python3 tools/generate_word_break_table.py path/to/UCD
+
+The UCD directory is the extracted UCD.zip of a Unicode release and must contain auxiliary/WordBreakProperty.txt,
+emoji/emoji-data.txt, Scripts.txt, PropList.txt and LineBreak.txt. Use the Unicode version of the ICU txtlib is built against, so
+that the table-driven word segmenter and ICU's BreakIterator agree.
+
+Every code point gets one byte: its Word_Break property in the low five bits, plus a flag for Extended_Pictographic
+and a flag for the characters ICU segments with dictionaries (Han, Hiragana, Katakana and Line_Break=SA), tags as
+ideographic or segments with rules of their own (Hangul syllables), which the segmenter hands back to ICU. Bytes are
+stored in a two-stage table of deduplicated blocks.
+"""
+
+import os
+import re
+import sys
+
+WORD_BREAK_PROPERTIES = [
+    "Other", "CR", "LF", "Newline", "Extend", "ZWJ", "Regional_Indicator", "Format", "Katakana", "Hebrew_Letter",
+    "ALetter", "Single_Quote", "Double_Quote", "MidNumLet", "MidLetter", "MidNum", "Numeric", "ExtendNumLet",
+    "WSegSpace"
+]
+EXTENDED_PICTOGRAPHIC = 0x20
+DICTIONARY = 0x40
+DICTIONARY_SCRIPTS = {"Han", "Hiragana"}
+# ICU adds the halfwidth voiced sound marks, which are Extend in the UCD, to its Katakana set. Its root rules also keep
+# Hangul syllables apart from other letters and digits, unlike the UCD's ALetter, so Korean text is handed to ICU too.
+DICTIONARY_EXTRA = [0xFF9E, 0xFF9F] + list(range(0xAC00, 0xD7A4))
+# ICU's root word rules tailor the UCD properties: colons are not MidLetter and "@" is ALetter.
+ICU_TAILORING = {0x003A: "Other", 0xFE55: "Other", 0xFF1A: "Other", 0x0040: "ALetter"}
+# ICU major versions whose root word rules the table and the tailoring above follow. Update it along with the UCD
+# version: txtlib falls back to ICU's BreakIterator on any other ICU.
+ICU_VERSIONS = (72, 73)
+
+N_CODE_POINTS = 0x110000
+LINE_PATTERN = re.compile(r"^([0-9A-Fa-f]+)(?:\.\.([0-9A-Fa-f]+))?\s*;\s*([A-Za-z_]+)")
+
+
+def read_property_file(path):
+    """Yields (first, last, value) for every range in a UCD property file."""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            match = LINE_PATTERN.match(line)
+            if match:
+                first = int(match.group(1), 16)
+                last = int(match.group(2), 16) if match.group(2) else first
+                yield first, last, match.group(3)
+
+
+def read_version(path):
+    with open(path, encoding="utf-8") as f:
+        match = re.search(r"-(\d+\.\d+\.\d+)\.txt", f.readline())
+        return match.group(1) if match else "unknown"
+
+
+def build_properties(ucd):
+    properties = bytearray(N_CODE_POINTS)
+    word_break_path = os.path.join(ucd, "auxiliary", "WordBreakProperty.txt")
+
+    for first, last, value in read_property_file(word_break_path):
+        index = WORD_BREAK_PROPERTIES.index(value)
+        for c in range(first, last + 1):
+            properties[c] = index
+    for c, value in ICU_TAILORING.items():
+        properties[c] = WORD_BREAK_PROPERTIES.index(value)
+
+    for first, last, value in read_property_file(os.path.join(ucd, "emoji", "emoji-data.txt")):
+        if value == "Extended_Pictographic":
+            for c in range(first, last + 1):
+                properties[c] |= EXTENDED_PICTOGRAPHIC
+
+    dictionary = set(DICTIONARY_EXTRA)
+    for first, last, value in read_property_file(os.path.join(ucd, "Scripts.txt")):
+        if value in DICTIONARY_SCRIPTS:
+            dictionary.update(range(first, last + 1))
+    for first, last, value in read_property_file(os.path.join(ucd, "PropList.txt")):
+        if value == "Ideographic":
+            dictionary.update(range(first, last + 1))
+    for first, last, value in read_property_file(os.path.join(ucd, "LineBreak.txt")):
+        if value == "SA":
+            dictionary.update(range(first, last + 1))
+    katakana = WORD_BREAK_PROPERTIES.index("Katakana")
+    dictionary.update(c for c in range(N_CODE_POINTS) if properties[c] & 0x1F == katakana)
+
+    for c in dictionary:
+        properties[c] |= DICTIONARY
+
+    return properties, read_version(word_break_path)
+
+
+def build_stages(properties, shift):
+    block_size = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = bytearray()
+
+    for start in range(0, N_CODE_POINTS, block_size):
+        block = bytes(properties[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2 += block
+        stage1.append(blocks[block])
+
+    return stage1, stage2
+
+
+def format_array(values, per_line=24):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("        " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main(ucd, output_dir):
+    properties, version = build_properties(ucd)
+
+    # Picks the block size giving the smallest table.
+    best = None
+    for shift in range(4, 11):
+        stage1, stage2 = build_stages(properties, shift)
+        stage1_type = "uint8_t" if max(stage1) < 256 else "uint16_t"
+        size = len(stage1) * (1 if stage1_type == "uint8_t" else 2) + len(stage2)
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, stage2, stage1_type)
+    size, shift, stage1, stage2, stage1_type = best
+
+    header = "// Generated by tools/generate_word_break_table.py from Unicode {} data. Do not edit by hand.\n".format(version)
+    enum_values = ",\n".join("            {} = {}".format(p, i) for i, p in enumerate(WORD_BREAK_PROPERTIES))
+
+    with open(os.path.join(output_dir, "word_break_table.h"), "w") as f:
+        f.write(header)
+        f.write("""#ifndef _WORD_BREAK_TABLE_
+#define _WORD_BREAK_TABLE_
+
+#include <cstdint>
+
+namespace txtlib {{
+    namespace word_break {{
+        enum Property : uint8_t {{
+{enum_values}
+        }};
+
+        // Unicode version of the table and ICU major versions whose root word rules it follows.
+        const int UNICODE_VERSION_MAJOR = {unicode_major};
+        const int UNICODE_VERSION_MINOR = {unicode_minor};
+        const int FIRST_ICU_VERSION = {first_icu};
+        const int LAST_ICU_VERSION = {last_icu};
+
+        const uint8_t PROPERTY_MASK = 0x1F;
+        const uint8_t EXTENDED_PICTOGRAPHIC = 0x{ext:02X};
+        const uint8_t DICTIONARY = 0x{dictionary:02X};
+
+        const int BLOCK_SHIFT = {shift};
+        const uint32_t BLOCK_MASK = (1U << BLOCK_SHIFT) - 1;
+
+        extern const {stage1_type} stage1[{n_stage1}];
+        extern const uint8_t stage2[{n_stage2}];
+
+        // Word_Break property and flags of a code point. Code points must be <= 0x10FFFF.
+        inline uint8_t lookup(uint32_t c) {{
+            return stage2[(static_cast< uint32_t >(stage1[c >> BLOCK_SHIFT]) << BLOCK_SHIFT) | (c & BLOCK_MASK)];
+        }}
+    }}
+}}
+
+#endif
+""".format(enum_values=enum_values, unicode_major=version.split(".")[0], unicode_minor=version.split(".")[1],
+           first_icu=min(ICU_VERSIONS), last_icu=max(ICU_VERSIONS), ext=EXTENDED_PICTOGRAPHIC, dictionary=DICTIONARY, shift=shift,
+           stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2)))
+
+    with open(os.path.join(output_dir, "word_break_table.cpp"), "w") as f:
+        f.write(header)
+        f.write("""#include "word_break_table.h"
+
+namespace txtlib {{
+    namespace word_break {{
+        const {stage1_type} stage1[{n_stage1}] = {{
+{stage1}
+        }};
+
+        const uint8_t stage2[{n_stage2}] = {{
+{stage2}
+        }};
+    }}
+}}
+""".format(stage1_type=stage1_type, n_stage1=len(stage1), n_stage2=len(stage2),
+           stage1=format_array(stage1), stage2=format_array(list(stage2))))
+
+    print("Unicode {}: {} blocks of {} code points, {} bytes".format(version, len(stage2) >> shift, 1 << shift, size))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: generate_word_break_table.py path/to/UCD")
+    main(sys.argv[1], os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))